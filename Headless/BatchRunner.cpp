@@ -0,0 +1,39 @@
+// Headless/BatchRunner.cpp
+#include "BatchRunner.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace Headless {
+
+    BatchRunner::BatchRunner(Simulation simulation, const std::size_t threads)
+        : simulation(std::move(simulation)), pool(threads) {}
+
+    std::vector<SimulationResult> BatchRunner::run(const std::vector<GameSpec>& games) {
+        // Each task writes only its own slot, so no locking is needed
+        std::vector<SimulationResult> results(games.size());
+        for (std::size_t i = 0; i < games.size(); ++i) {
+            pool.submit([this, &games, &results, i] {
+                const GameSpec& game = games[i];
+                results[i] = simulation.run(game.input, game.seed, game.levels);
+            });
+        }
+        pool.wait();
+        return results;
+    }
+
+    BatchSummary BatchRunner::summarize(const std::vector<SimulationResult>& results) {
+        BatchSummary summary;
+        for (const SimulationResult& result : results) {
+            summary.games++;
+            if (result.gameOver) summary.gamesOver++;
+            summary.ticks += result.ticks;
+            summary.totalScore += result.score;
+            summary.bestScore = std::max(summary.bestScore, result.score);
+            summary.deaths += result.deaths;
+            summary.levelsCleared += static_cast<int>(result.levelTicks.size());
+            for (const long ticks : result.levelTicks) summary.levelTicks += ticks;
+        }
+        return summary;
+    }
+}
@@ -0,0 +1,79 @@
+// Headless/BatchRunner.h
+#ifndef PACMAN_RETRY_BATCHRUNNER_H
+#define PACMAN_RETRY_BATCHRUNNER_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Simulation.h"
+#include "ThreadPool.h"
+#include "Logic/MapLoader.h"
+
+namespace Headless {
+
+    /**
+     * @struct GameSpec
+     * @brief One game of a batch: everything that makes it different from the others
+     */
+    struct GameSpec {
+        std::uint64_t seed = 0;
+        std::shared_ptr<const Logic::LevelSet> levels;  ///< Usually one set shared by the whole batch
+        InputProvider input;  ///< Bot or replay; called only from the thread running this game
+    };
+
+    /**
+     * @struct BatchSummary
+     * @brief Totals over the results of a batch
+     */
+    struct BatchSummary {
+        int games = 0;
+        int gamesOver = 0;        ///< Games that ended before the tick limit
+        long ticks = 0;
+        long totalScore = 0;
+        int bestScore = 0;
+        int deaths = 0;
+        int levelsCleared = 0;
+        long levelTicks = 0;      ///< Sum over every cleared level
+
+        [[nodiscard]] double averageScore() const { return games > 0 ? static_cast<double>(totalScore) / games : 0.0; }
+        [[nodiscard]] double averageLevelTicks() const {
+            return levelsCleared > 0 ? static_cast<double>(levelTicks) / levelsCleared : 0.0;
+        }
+    };
+
+    /**
+     * @class BatchRunner
+     * @brief Runs many independent games concurrently on a ThreadPool
+     *
+     * Every game gets its own World (and with it its own random generator),
+     * so games share nothing but the read-only Simulation settings and maps,
+     * and the results come out identical to running them one after the other.
+     */
+    class BatchRunner {
+    private:
+        Simulation simulation;
+        ThreadPool pool;
+
+    public:
+        /**
+         * @param simulation Tick length and tick limit of every game
+         * @param threads Worker threads; 0 uses every hardware thread
+         */
+        explicit BatchRunner(Simulation simulation, std::size_t threads = 0);
+
+        /**
+         * @brief Plays every game and waits for all of them
+         * @return One result per spec, in the order of the specs
+         */
+        [[nodiscard]] std::vector<SimulationResult> run(const std::vector<GameSpec>& games);
+
+        /**
+         * @brief Aggregates scores, deaths and level times
+         */
+        [[nodiscard]] static BatchSummary summarize(const std::vector<SimulationResult>& results);
+
+        [[nodiscard]] std::size_t threadCount() const { return pool.size(); }
+    };
+}
+
+#endif //PACMAN_RETRY_BATCHRUNNER_H
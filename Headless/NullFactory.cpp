@@ -0,0 +1,38 @@
+// Headless/NullFactory.cpp
+#include "NullFactory.h"
+
+#include "Logic/Entities/Coin.h"
+#include "Logic/Entities/Fruit.h"
+#include "Logic/Entities/Pacman.h"
+#include "Logic/Entities/GhostsTypes.h"
+
+namespace Headless {
+
+    std::shared_ptr<Logic::Pacman> NullFactory::createPacMan(Logic::EntityStore& store, float x, float y, float w, float h) {
+        return arena->make<Logic::Pacman>(store, x, y, w, h);
+    }
+
+    std::shared_ptr<Logic::Ghost> NullFactory::createGhost(Logic::EntityStore& store, float x, float y, float w, float h, char type) {
+        // Same type mapping as Render::ConcreteFactory
+        switch (type) {
+            case 'I': return arena->make<Logic::PinkGhost>(store, x, y, w, h);
+            case 'B': return arena->make<Logic::BlueGhost>(store, x, y, w, h);
+            case 'O': return arena->make<Logic::OrangeGhost>(store, x, y, w, h);
+            case 'R':
+            default: return arena->make<Logic::RedGhost>(store, x, y, w, h);
+        }
+    }
+
+    std::shared_ptr<Logic::Coin> NullFactory::createCoin(Logic::EntityStore& store, float x, float y, float w, float h) {
+        return arena->make<Logic::Coin>(store, x, y, w, h);
+    }
+
+    std::shared_ptr<Logic::Fruit> NullFactory::createFruit(Logic::EntityStore& store, float x, float y, float w, float h) {
+        return arena->make<Logic::Fruit>(store, x, y, w, h);
+    }
+
+    void NullFactory::createWalls(const Logic::TileGrid&) {
+        // Nothing draws them; the World keeps its own wall grid
+    }
+
+}
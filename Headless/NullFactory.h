@@ -0,0 +1,30 @@
+// Headless/NullFactory.h
+#ifndef PACMAN_RETRY_NULLFACTORY_H
+#define PACMAN_RETRY_NULLFACTORY_H
+
+#include "Logic/AbstractFactory.h"
+
+namespace Headless {
+
+    /**
+     * @class NullFactory
+     * @brief AbstractFactory that creates bare Logic entities with no views attached
+     *
+     * Used to run the World without a window: entities still publish events,
+     * but they have no observers, so every notify() stops at the subscription
+     * mask test and nothing is drawn.
+     */
+    class NullFactory final : public Logic::AbstractFactory {
+    public:
+        NullFactory() = default;
+        ~NullFactory() override = default;
+
+        std::shared_ptr<Logic::Pacman> createPacMan(Logic::EntityStore& store, float x, float y, float w, float h) override;
+        std::shared_ptr<Logic::Ghost> createGhost(Logic::EntityStore& store, float x, float y, float w, float h, char type) override;
+        std::shared_ptr<Logic::Coin> createCoin(Logic::EntityStore& store, float x, float y, float w, float h) override;
+        std::shared_ptr<Logic::Fruit> createFruit(Logic::EntityStore& store, float x, float y, float w, float h) override;
+        void createWalls(const Logic::TileGrid& walls) override;
+    };
+}
+
+#endif //PACMAN_RETRY_NULLFACTORY_H
@@ -0,0 +1,46 @@
+// Headless/Simulation.cpp
+#include "Simulation.h"
+
+#include <memory>
+#include "NullFactory.h"
+#include "Logic/World.h"
+
+namespace Headless {
+
+    Simulation::Simulation(const float deltaTime, const long maxTicks)
+        : deltaTime(deltaTime), maxTicks(maxTicks) {}
+
+    SimulationResult Simulation::run(const InputProvider& input, const std::uint64_t seed,
+                                     const std::shared_ptr<const Logic::LevelSet>& levels) const {
+        Logic::World world(std::make_shared<NullFactory>(), seed, levels);
+
+        SimulationResult result;
+        long levelStart = 0;
+        int lives = world.getLives();
+        while (result.ticks < maxTicks) {
+            if (world.isGameOver()) {
+                result.gameOver = true;
+                break;
+            }
+
+            // Same order as the window game's simulation thread and LevelState
+            if (world.isLevelComplete()) {
+                result.levelTicks.push_back(result.ticks - levelStart);
+                levelStart = result.ticks;
+                world.nextLevel();
+            }
+
+            world.update(input(world, result.ticks), deltaTime);
+            result.ticks++;
+
+            if (const int now = world.getLives(); now < lives) result.deaths += lives - now;
+            lives = world.getLives();
+        }
+
+        result.gameOver = world.isGameOver();
+        result.score = world.getScore();
+        result.lives = world.getLives();
+        result.level = world.getCurrentLevel();
+        return result;
+    }
+}
@@ -0,0 +1,76 @@
+// Headless/Simulation.h
+#ifndef PACMAN_RETRY_SIMULATION_H
+#define PACMAN_RETRY_SIMULATION_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Logic {
+    class World;
+    class LevelSet;
+}
+
+namespace Headless {
+
+    /**
+     * @brief Supplies the player input for one tick
+     *
+     * Receives the world (read-only) and the index of the tick about to be
+     * simulated, returns 'U', 'D', 'L', 'R' or 0 for no input.
+     */
+    using InputProvider = std::function<char(const Logic::World& world, long tick)>;
+
+    /**
+     * @struct SimulationResult
+     * @brief Outcome of one headless game
+     */
+    struct SimulationResult {
+        int score = 0;          ///< Final score
+        int lives = 0;          ///< Lives left when the run ended
+        int level = 1;          ///< Level reached
+        long ticks = 0;         ///< Number of World::update calls performed
+        int deaths = 0;         ///< Lives lost during the run
+        std::vector<long> levelTicks;  ///< Ticks each cleared level took, in order
+        bool gameOver = false;  ///< true if the game ended, false if the tick limit was hit
+    };
+
+    /**
+     * @class Simulation
+     * @brief Runs a World without a window at a fixed time step
+     *
+     * The world is built through NullFactory, so no views or textures are
+     * created, and World::update is called with the injected delta time
+     * instead of reading the Stopwatch. A run ends on game over or after
+     * maxTicks updates, whichever comes first.
+     */
+    class Simulation {
+    private:
+        float deltaTime;
+        long maxTicks;
+
+    public:
+        /**
+         * @param deltaTime Seconds simulated per tick (e.g. 1/120)
+         * @param maxTicks Upper bound on the number of ticks per game
+         */
+        Simulation(float deltaTime, long maxTicks);
+
+        /**
+         * @brief Plays one complete game
+         * @param input Called once per tick to obtain the player input
+         * @param seed Seed for the world's random generator
+         * @param levels Maps of the game, shared read-only between concurrent runs
+         * @return Score, lives, level, deaths and tick counts at the end of the run
+         *
+         * Deterministic: the same seed, map and inputs give the same result.
+         * Const and free of shared state, so one Simulation can run many
+         * games on different threads at once.
+         */
+        [[nodiscard]] SimulationResult run(const InputProvider& input, std::uint64_t seed,
+                                           const std::shared_ptr<const Logic::LevelSet>& levels) const;
+    };
+}
+
+#endif //PACMAN_RETRY_SIMULATION_H
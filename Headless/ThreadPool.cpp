@@ -0,0 +1,99 @@
+// Headless/ThreadPool.cpp
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <exception>
+#include <iostream>
+
+namespace Headless {
+
+    ThreadPool::ThreadPool(std::size_t threadCount) {
+        if (threadCount == 0) threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+        queues.reserve(threadCount);
+        for (std::size_t i = 0; i < threadCount; ++i) queues.push_back(std::make_unique<Queue>());
+
+        workers.reserve(threadCount);
+        for (std::size_t i = 0; i < threadCount; ++i) workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard lock(stateMutex);
+            stopping = true;
+        }
+        taskAvailable.notify_all();
+        for (auto& worker : workers) worker.join();
+    }
+
+    void ThreadPool::submit(std::function<void()> task) {
+        Queue& queue = *queues[nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size()];
+        {
+            // Counted in the same critical section, so a worker can't take the task before it is counted
+            std::lock_guard state(stateMutex);
+            std::lock_guard lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+            queued++;
+            pending++;
+        }
+        taskAvailable.notify_one();
+    }
+
+    void ThreadPool::wait() {
+        std::unique_lock lock(stateMutex);
+        allDone.wait(lock, [this] { return pending == 0; });
+    }
+
+    bool ThreadPool::takeTask(const std::size_t worker, std::function<void()>& task) {
+        // Own deque first, newest task (still warm in this core's cache)
+        {
+            Queue& own = *queues[worker];
+            std::lock_guard lock(own.mutex);
+            if (!own.tasks.empty()) {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                return true;
+            }
+        }
+
+        // Then steal the oldest task of another worker
+        for (std::size_t offset = 1; offset < queues.size(); ++offset) {
+            Queue& victim = *queues[(worker + offset) % queues.size()];
+            std::lock_guard lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void ThreadPool::workerLoop(const std::size_t worker) {
+        std::function<void()> task;
+        while (true) {
+            if (takeTask(worker, task)) {
+                {
+                    std::lock_guard lock(stateMutex);
+                    queued--;
+                }
+
+                try {
+                    task();
+                } catch (const std::exception& e) {
+                    std::cerr << "Task failed: " << e.what() << std::endl;
+                }
+                task = nullptr;
+
+                std::lock_guard lock(stateMutex);
+                if (--pending == 0) allDone.notify_all();
+                continue;
+            }
+
+            // Another worker may have taken the task that was announced; sleep until there is one
+            std::unique_lock lock(stateMutex);
+            taskAvailable.wait(lock, [this] { return stopping || queued > 0; });
+            if (stopping && queued == 0) return;
+        }
+    }
+}
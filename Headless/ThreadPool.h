@@ -0,0 +1,78 @@
+// Headless/ThreadPool.h
+#ifndef PACMAN_RETRY_THREADPOOL_H
+#define PACMAN_RETRY_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Headless {
+
+    /**
+     * @class ThreadPool
+     * @brief Fixed set of worker threads with one task deque each and work stealing
+     *
+     * Tasks are spread round-robin over the workers' deques. A worker takes
+     * its own tasks from the back and, once its deque is empty, steals from
+     * the front of the others, so a worker that drew a few long games does
+     * not leave the rest of the pool idle.
+     *
+     * Meant for coarse tasks (a whole game each): every deque has its own
+     * mutex, which is never contended long enough to matter at that size.
+     */
+    class ThreadPool {
+    private:
+        struct Queue {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        std::vector<std::unique_ptr<Queue>> queues;  ///< One per worker
+        std::vector<std::thread> workers;
+        std::atomic<std::size_t> nextQueue{0};       ///< Round-robin target of submit()
+
+        std::mutex stateMutex;
+        std::condition_variable taskAvailable;
+        std::condition_variable allDone;
+        std::size_t queued = 0;   ///< Tasks sitting in a deque
+        std::size_t pending = 0;  ///< Tasks submitted but not finished
+        bool stopping = false;
+
+        bool takeTask(std::size_t worker, std::function<void()>& task);
+        void workerLoop(std::size_t worker);
+
+    public:
+        /**
+         * @param threadCount Number of workers; 0 uses every hardware thread
+         */
+        explicit ThreadPool(std::size_t threadCount = 0);
+
+        /**
+         * @brief Finishes the queued tasks, then joins the workers
+         */
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * @brief Queues a task; exceptions it throws are reported and swallowed
+         */
+        void submit(std::function<void()> task);
+
+        /**
+         * @brief Blocks until every submitted task has finished
+         */
+        void wait();
+
+        [[nodiscard]] std::size_t size() const { return workers.size(); }
+    };
+}
+
+#endif //PACMAN_RETRY_THREADPOOL_H
@@ -0,0 +1,192 @@
+// Headless/main.cpp - Runs games without a window for batch workloads
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BatchRunner.h"
+#include "Simulation.h"
+#include "Logic/Log.h"
+#include "Logic/Profiler.h"
+#include "Logic/Replay.h"
+#include "Logic/World.h"
+
+namespace {
+    struct Options {
+        int games = 100;
+        long ticks = 120L * 60L * 5L;  // 5 minutes of game time at 120 Hz
+        float deltaTime = 1.0f / 120.0f;  // Same logic tick as LevelState
+        unsigned int seed = 1;
+        std::size_t threads = 0;  // 0 = one worker per hardware thread
+        std::string mapName = Logic::World::DEFAULT_MAP;
+        std::string recordPath;  // Save the first game's replay here
+        std::string replayPath;  // Play back this replay instead of running the bot
+        bool profile = false;    // Print per-phase percentiles after the run
+        std::string tracePath;   // Write a Chrome trace of the whole run here
+    };
+
+    Options parseOptions(int argc, char* argv[]) {
+        Options options;
+        for (int i = 1; i + 1 < argc; i += 2) {
+            const std::string flag = argv[i];
+            const char* value = argv[i + 1];
+            if (flag == "--games") options.games = std::atoi(value);
+            else if (flag == "--ticks") options.ticks = std::atol(value);
+            else if (flag == "--dt") options.deltaTime = static_cast<float>(std::atof(value));
+            else if (flag == "--seed") options.seed = static_cast<unsigned int>(std::atol(value));
+            else if (flag == "--threads") options.threads = static_cast<std::size_t>(std::atol(value));
+            else if (flag == "--map") options.mapName = value;
+            else if (flag == "--record") options.recordPath = value;
+            else if (flag == "--replay") options.replayPath = value;
+            else if (flag == "--profile") options.profile = std::atoi(value) != 0;
+            else if (flag == "--trace") options.tracePath = value;
+            else if (flag == "--log") {
+                Logic::LogLevel level;
+                if (Logic::Logger::parseLevel(value, level)) Logic::Logger::setLevel(level);
+                else std::cerr << "Unknown log level: " << value << std::endl;
+            }
+            else std::cerr << "Unknown option: " << flag << std::endl;
+        }
+        return options;
+    }
+
+    void printResult(const int game, const Headless::SimulationResult& result) {
+        std::cout << "Game " << game << ": score " << result.score
+                  << ", level " << result.level
+                  << ", lives " << result.lives
+                  << ", ticks " << result.ticks
+                  << ", deaths " << result.deaths
+                  << (result.gameOver ? " (game over)" : " (tick limit)") << std::endl;
+    }
+
+    void printProfile() {
+        const Logic::Profiler& profiler = Logic::Profiler::getInstance();
+        std::cout << std::fixed << std::setprecision(2) << "Phase          p50 us     p99 us    samples" << std::endl;
+        for (std::size_t i = 0; i < static_cast<std::size_t>(Logic::ProfilePhase::Count); ++i) {
+            const auto phase = static_cast<Logic::ProfilePhase>(i);
+            const Logic::PhaseStats stats = profiler.stats(phase);
+            if (stats.samples == 0) continue;
+            std::cout << std::left << std::setw(10) << Logic::Profiler::phaseName(phase) << std::right
+                      << std::setw(11) << stats.p50 << std::setw(11) << stats.p99 << std::setw(11) << stats.samples
+                      << std::endl;
+        }
+        std::cout << std::defaultfloat;
+    }
+
+    // Replays a recorded game with the recorded seed, tick length and inputs
+    int playReplay(const std::string& path) {
+        Logic::Replay replay;
+        try {
+            replay = Logic::Replay::load(path);
+        } catch (const std::exception& e) {
+            std::cerr << "Failed to load replay! " << e.what() << std::endl;
+            return 1;
+        }
+
+        std::shared_ptr<const Logic::LevelSet> levels;
+        try {
+            levels = std::make_shared<const Logic::LevelSet>(Logic::LevelSet::load(replay.getMapName()));
+        } catch (const std::exception& e) {
+            std::cerr << "Failed to load maps! " << e.what() << std::endl;
+            return 1;
+        }
+
+        const Headless::Simulation simulation(replay.getTickLength(), static_cast<long>(replay.getTickCount()));
+        const auto input = [&](const Logic::World& world, const long tick) {
+            if (tick == 0 && world.getMapHash() != replay.getMapHash()) {
+                std::cerr << "Replay was recorded on a different version of " << replay.getMapName()
+                          << ", playback will diverge" << std::endl;
+            }
+            return replay.inputAt(static_cast<std::size_t>(tick));
+        };
+
+        printResult(0, simulation.run(input, replay.getSeed(), levels));
+        return 0;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const Options options = parseOptions(argc, argv);
+    if (!options.replayPath.empty()) {
+        return playReplay(options.replayPath);
+    }
+
+    // Every map is read and validated once, then shared by all games
+    std::shared_ptr<const Logic::LevelSet> levels;
+    try {
+        levels = std::make_shared<const Logic::LevelSet>(Logic::LevelSet::load(options.mapName));
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to load maps! " << e.what() << std::endl;
+        return 1;
+    }
+
+    Headless::BatchRunner runner(Headless::Simulation(options.deltaTime, options.ticks), options.threads);
+
+    std::vector<Headless::GameSpec> games;
+    games.reserve(options.games);
+    for (int game = 0; game < options.games; ++game) {
+        // Simple bot: holds a random direction and picks a new one every half second.
+        // Each game owns its bot state, so games can run on any thread.
+        const std::uint64_t seed = options.seed + game;
+        auto bot = [botRng = std::mt19937(options.seed + game), heldInput = 'L'](const Logic::World&, const long tick) mutable {
+            if (tick % 60 == 0) heldInput = "UDLR"[botRng() % 4];
+            return heldInput;
+        };
+        games.push_back({seed, levels, bot});
+    }
+
+    // Game 0 also records its input; filled in on the first tick, once the map is loaded
+    const auto replay = std::make_shared<Logic::Replay>();
+    if (!games.empty() && !options.recordPath.empty()) {
+        games[0].input = [replay, seed = games[0].seed, deltaTime = options.deltaTime, bot = games[0].input](
+                             const Logic::World& world, const long tick) {
+            if (tick == 0) *replay = Logic::Replay(seed, deltaTime, world.getMapName(), world.getMapHash());
+            const char input = bot(world, tick);
+            replay->record(input);
+            return input;
+        };
+    }
+
+    if (options.profile || !options.tracePath.empty()) Logic::Profiler::setEnabled(true);
+    if (!options.tracePath.empty()) Logic::Profiler::getInstance().startTrace();
+
+    const auto start = std::chrono::steady_clock::now();
+    const std::vector<Headless::SimulationResult> results = runner.run(games);
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    if (!options.tracePath.empty()) {
+        try {
+            const std::size_t events = Logic::Profiler::getInstance().stopTrace(options.tracePath);
+            std::cerr << "Trace saved to " << options.tracePath << " (" << events << " events)" << std::endl;
+        } catch (const std::exception& e) {
+            std::cerr << "Failed to save trace! " << e.what() << std::endl;
+        }
+    }
+
+    if (!games.empty() && !options.recordPath.empty()) {
+        try {
+            replay->save(options.recordPath);
+        } catch (const std::exception& e) {
+            std::cerr << "Failed to save replay! " << e.what() << std::endl;
+        }
+    }
+
+    for (std::size_t game = 0; game < results.size(); ++game) {
+        printResult(static_cast<int>(game), results[game]);
+    }
+
+    const Headless::BatchSummary summary = Headless::BatchRunner::summarize(results);
+    std::cout << summary.games << " games on " << runner.threadCount() << " threads, " << summary.ticks << " ticks in "
+              << elapsed.count() << " s (" << (elapsed.count() > 0.0 ? summary.ticks / elapsed.count() : 0.0)
+              << " ticks/s)" << std::endl;
+    std::cout << "Average score " << summary.averageScore() << ", best " << summary.bestScore
+              << ", deaths " << summary.deaths << ", game over in " << summary.gamesOver << "/" << summary.games
+              << ", " << summary.levelsCleared << " levels cleared in " << summary.averageLevelTicks()
+              << " ticks on average" << std::endl;
+    if (options.profile) printProfile();
+    return 0;
+}
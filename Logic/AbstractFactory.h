@@ -2,23 +2,37 @@
 #ifndef PACMAN_RETRY_ABSTRACTFACTORY_H
 #define PACMAN_RETRY_ABSTRACTFACTORY_H
 #include <memory>
+#include "LevelArena.h"
 
 namespace Logic {
     class Pacman;
     class Fruit;
     class Coin;
-    class Wall;
     class Ghost;
+    class EntityStore;
+    class TileGrid;
 
     class AbstractFactory {
     public:
         virtual ~AbstractFactory() = default;
 
-        virtual std::shared_ptr<Pacman> createPacMan(float x, float y, float w, float h) = 0;
-        virtual std::shared_ptr<Ghost> createGhost(float x, float y, float w, float h, char type) = 0;
-        virtual std::shared_ptr<Coin> createCoin(float x, float y, float w, float h) = 0;
-        virtual std::shared_ptr<Fruit> createFruit(float x, float y, float w, float h) = 0;
-        virtual std::shared_ptr<Wall> createWall(float x, float y, float w, float h) = 0;
+        // Every entity gets a row in the World's store for its data
+
+        virtual std::shared_ptr<Pacman> createPacMan(EntityStore& store, float x, float y, float w, float h) = 0;
+        virtual std::shared_ptr<Ghost> createGhost(EntityStore& store, float x, float y, float w, float h, char type) = 0;
+        virtual std::shared_ptr<Coin> createCoin(EntityStore& store, float x, float y, float w, float h) = 0;
+        virtual std::shared_ptr<Fruit> createFruit(EntityStore& store, float x, float y, float w, float h) = 0;
+
+        // Walls are not entities: called once per built level with its finished wall grid
+        virtual void createWalls(const TileGrid& walls) = 0;
+
+        // Called before the World builds a different map: drop anything cached for the old one.
+        // Overrides must call this too; the old arena is freed once the old level's objects are gone
+        virtual void clearLevel() { arena = std::make_shared<LevelArena>(); }
+
+    protected:
+        // Backs every entity (and view) created for the current level
+        std::shared_ptr<LevelArena> arena = std::make_shared<LevelArena>();
     };
 }
 #endif //PACMAN_RETRY_ABSTRACTFACTORY_H
\ No newline at end of file
@@ -0,0 +1,54 @@
+// Logic/DistanceField.cpp
+#include "DistanceField.h"
+#include "TileGrid.h"
+
+namespace Logic {
+
+    bool DistanceField::setRoot(const TileGrid& grid, const int tileX, const int tileY) {
+        if (!grid.inBounds(tileX, tileY)) return false;
+
+        const int rootIndex = grid.index(tileX, tileY);
+        if (rootIndex == root && width == grid.getWidth() && height == grid.getHeight()) return false;
+
+        flood(grid, {rootIndex});
+        return true;
+    }
+
+    void DistanceField::setRoots(const TileGrid& grid, const std::vector<int>& tiles) {
+        flood(grid, tiles);
+    }
+
+    void DistanceField::flood(const TileGrid& grid, const std::vector<int>& roots) {
+        width = grid.getWidth();
+        height = grid.getHeight();
+        root = roots.empty() ? -1 : roots.front();
+        distances.assign(static_cast<std::size_t>(width) * static_cast<std::size_t>(height), UNREACHABLE);
+        frontier.clear();
+
+        for (const int tile : roots) {
+            if (tile < 0 || tile >= static_cast<int>(distances.size()) || distances[tile] == 0) continue;
+            distances[tile] = 0;
+            frontier.push_back(tile);
+        }
+
+        // The frontier only grows, so a read cursor makes it a FIFO queue
+        for (std::size_t head = 0; head < frontier.size(); ++head) {
+            const int tile = frontier[head];
+            const int x = tile % width;
+            const int y = tile / width;
+            const std::uint8_t exits = grid.exitsAt(x, y);
+            const std::uint16_t next = distances[tile] + 1;
+
+            const auto visit = [&](const int neighbour) {
+                if (distances[neighbour] == UNREACHABLE) {
+                    distances[neighbour] = next;
+                    frontier.push_back(neighbour);
+                }
+            };
+            if (exits & Exits::UP) visit(tile - width);
+            if (exits & Exits::DOWN) visit(tile + width);
+            if (exits & Exits::LEFT) visit(tile - 1);
+            if (exits & Exits::RIGHT) visit(tile + 1);
+        }
+    }
+}
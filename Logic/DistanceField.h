@@ -0,0 +1,84 @@
+// Logic/DistanceField.h
+#ifndef PACMAN_RETRY_DISTANCEFIELD_H
+#define PACMAN_RETRY_DISTANCEFIELD_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file DistanceField.h
+ * @brief Maze distances from one tile to every walkable tile
+ *
+ * A breadth-first flood over the TileGrid gives, for every tile, the number
+ * of steps along corridors to the root tile. A ghost standing at a junction
+ * picks the exit whose neighbour has the smallest distance, which follows the
+ * maze instead of the straight line and never walks into a dead end.
+ *
+ * World owns the fields and moves their roots each tick; a field only floods
+ * again when its root tile actually changes, so all ghosts share one BFS per
+ * Pacman tile change. A field can also be flooded from several tiles at
+ * once (the ghost house), giving the distance to the nearest of them.
+ */
+
+namespace Logic {
+    class TileGrid;
+
+    /**
+     * @class DistanceField
+     * @brief BFS step counts to a root tile, one entry per tile
+     */
+    class DistanceField {
+    public:
+        static constexpr std::uint16_t UNREACHABLE = 0xFFFF;  ///< Walls and tiles cut off from the root
+
+    private:
+        std::vector<std::uint16_t> distances;  ///< Row-major, same layout as TileGrid
+        std::vector<int> frontier;             ///< BFS queue, kept to avoid reallocating
+        int width = 0;
+        int height = 0;
+        int root = -1;                         ///< Tile index the field was flooded from, -1 = none
+
+        void flood(const TileGrid& grid, const std::vector<int>& roots);
+
+    public:
+        DistanceField() = default;
+
+        /**
+         * @brief Floods the field from a tile unless it is already rooted there
+         * @param grid Walls of the current level
+         * @param tileX Root column
+         * @param tileY Root row
+         * @return true if the field was rebuilt
+         */
+        bool setRoot(const TileGrid& grid, int tileX, int tileY);
+
+        /**
+         * @brief Floods the field from several tiles at once
+         * @param grid Walls of the current level
+         * @param tiles Row-major tile indices that get distance 0
+         *
+         * Always rebuilds; meant for fields that are set up once per level.
+         */
+        void setRoots(const TileGrid& grid, const std::vector<int>& tiles);
+
+        /**
+         * @brief Forgets the root so the next setRoot() floods again (call on a new map)
+         */
+        void clear() { root = -1; }
+
+        /**
+         * @brief Steps from a tile to the root, UNREACHABLE for walls and outside the grid
+         */
+        [[nodiscard]] std::uint16_t at(const int tileX, const int tileY) const {
+            if (tileX < 0 || tileY < 0 || tileX >= width || tileY >= height) return UNREACHABLE;
+            return distances[tileY * width + tileX];
+        }
+
+        /**
+         * @brief Single root of the field (the first one after setRoots), -1 if none
+         */
+        [[nodiscard]] int getRoot() const { return root; }
+    };
+}
+
+#endif //PACMAN_RETRY_DISTANCEFIELD_H
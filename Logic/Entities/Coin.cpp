@@ -5,7 +5,9 @@
 #include "Coin.h"
 
 namespace Logic {
-    void Coin::update() const {
-        notify();
+    void Coin::collect() {
+        if (isHidden()) return;
+        setHidden(true);
+        notify(EventType::CoinCollected);
     }
 }
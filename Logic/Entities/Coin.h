@@ -8,17 +8,14 @@
 
 namespace Logic {
     class Coin final : public Entity {
-    private:
-        bool collected = false;
-
     public:
-        Coin(const float x, const float y, const float width, const float height) : Entity(x, y, width, height) {}
+        Coin(EntityStore& store, const float x, const float y, const float width, const float height)
+            : Entity(store, EntityKind::Coin, x, y, width, height) {}
         ~Coin() override = default;
 
-        [[nodiscard]] bool isCollected() const { return collected; }
-        void collect() { collected = true; }
-        void reset() { collected = false; }
-        void update() const;
+        [[nodiscard]] bool isCollected() const { return isHidden(); }
+        void collect();
+        void reset() { setHidden(false); }
     };
 }
 
@@ -6,34 +6,56 @@
 
 namespace Logic {
 
-    Entity::Entity(const float x, const float y, const float width, const float height)
-        : x(x), y(y), width(width), height(height) {}
+    Entity::Entity(EntityStore& store, const EntityKind kind, const float x, const float y, const float width, const float height)
+        : store(store), handle(store.create(kind, x, y, width, height)) {}
+
+    Entity::~Entity() {
+        store.destroy(handle);
+    }
 
     void Entity::setPosition(const float newX, const float newY) {
-        x = newX;
-        y = newY;
+        if (newX == getX() && newY == getY()) return;
+        store.setPosition(handle.index, newX, newY);
+        notify(EventType::EntityMoved);
+    }
+
+    void Entity::snapTo(const float newX, const float newY) {
+        store.setPreviousPosition(handle.index, newX, newY);
+        setPosition(newX, newY);
+    }
+
+    void Entity::setDirection(const char dir) {
+        if (dir == getDirection()) return;
+        store.setDirection(handle.index, dir);
+        notify(EventType::DirectionChanged);
+    }
+
+    void Entity::setStateInt(const int state) {
+        if (state == getStateInt()) return;
+        store.setState(handle.index, state);
+        notify(EventType::ModeChanged);
     }
 
     void Entity::setSize(const float w, const float h) {
-        width = w;
-        height = h;
+        store.setSize(handle.index, w, h);
     }
 
     bool Entity::intersects(const Entity& other) const {
         constexpr float epsilon = 0.008f; // Small tolerance
 
+        const float x = getX(), y = getY(), width = getWidth(), height = getHeight();
         const float left = x - width / 2.0f;
         const float right = x + width / 2.0f;
         const float top = y - height / 2.0f;
         const float bottom = y + height / 2.0f;
 
-        const float otherLeft = other.x - other.width / 2.0f;
-        const float otherRight = other.x + other.width / 2.0f;
-        const float otherTop = other.y - other.height / 2.0f;
-        const float otherBottom = other.y + other.height / 2.0f;
+        const float otherLeft = other.getX() - other.getWidth() / 2.0f;
+        const float otherRight = other.getX() + other.getWidth() / 2.0f;
+        const float otherTop = other.getY() - other.getHeight() / 2.0f;
+        const float otherBottom = other.getY() + other.getHeight() / 2.0f;
 
         return !(right <= otherLeft + epsilon || left >= otherRight - epsilon ||
                  bottom <= otherTop + epsilon || top >= otherBottom - epsilon);
     }
 
-} // namespace Logic
\ No newline at end of file
+} // namespace Logic
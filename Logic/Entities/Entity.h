@@ -4,45 +4,78 @@
 
 #ifndef PACMAN_RETRY_ENTITY_H
 #define PACMAN_RETRY_ENTITY_H
+#include "Logic/EntityStore.h"
 #include "Logic/Observer.h"
 
 namespace Logic {
+    // Behaviour wrapper around one EntityStore row; the data itself lives in the store
     class Entity : public Subject {
     private:
-        float x, y;
-        float width, height;
+        EntityStore& store;
+        EntityHandle handle;
     public:
-        Entity(float x, float y, float width, float height);
+        Entity(EntityStore& store, EntityKind kind, float x, float y, float width, float height);
+        ~Entity() override;
+
+        // The row is owned by this object, so copies would release it twice
+        Entity(const Entity&) = delete;
+        Entity& operator=(const Entity&) = delete;
 
         // Getters
-        [[nodiscard]] float getX() const { return x; }
-        [[nodiscard]] float getY() const { return y; }
-        [[nodiscard]] float getWidth() const { return width; }
-        [[nodiscard]] float getHeight() const { return height; }
+        [[nodiscard]] float getX() const { return store.getX(handle.index); }
+        [[nodiscard]] float getY() const { return store.getY(handle.index); }
+        [[nodiscard]] float getWidth() const { return store.getWidth(handle.index); }
+        [[nodiscard]] float getHeight() const { return store.getHeight(handle.index); }
+
+        // Position at the start of the current tick, for render interpolation
+        [[nodiscard]] float getPreviousX() const { return store.getPreviousX(handle.index); }
+        [[nodiscard]] float getPreviousY() const { return store.getPreviousY(handle.index); }
+
+        // Row in the store, for views and other readers of the packed data
+        [[nodiscard]] EntityHandle getHandle() const { return handle; }
+        [[nodiscard]] const EntityStore& getStore() const { return store; }
 
         // Setters
         void setPosition(float newX, float newY);
-        virtual void setSize(float w, float h);
 
-        // Virtual methods for animation data - can be overridden by derived classes
-        [[nodiscard]] virtual char getDirection() const { return ' '; }
-        [[nodiscard]] virtual bool isMoving() const { return false; }
+        // Moves without interpolating from the old position (respawns, resets)
+        void snapTo(float newX, float newY);
+        void setSize(float w, float h);
+
+        // Animation data, stored in the row so views can read it through a handle
+        [[nodiscard]] char getDirection() const { return store.getDirection(handle.index); }
+        [[nodiscard]] bool isMoving() const { return store.hasFlag(handle.index, EntityStore::MOVING); }
 
         // For ghost-specific state (returns -1 for non-ghosts)
         // 0=WAITING, 1=CHASING, 2=FEARED, 3=DEAD
-        [[nodiscard]] virtual int getStateInt() const { return -1; }
-        [[nodiscard]] virtual float getStateTimer() const { return 0.0f; }
+        [[nodiscard]] int getStateInt() const { return store.getState(handle.index); }
+        [[nodiscard]] float getStateTimer() const { return store.getTimer(handle.index); }
 
         // For sprite identification (returns -1 for non-ghosts)
         [[nodiscard]] virtual int getSpriteId() const { return -1; }
 
         // For death animation (Pacman-specific)
-        [[nodiscard]] virtual bool isDying() const { return false; }
+        [[nodiscard]] bool isDying() const { return store.hasFlag(handle.index, EntityStore::DYING); }
         [[nodiscard]] virtual int getLives() const { return 0; }
 
+        // Collected pickups stay alive (hidden) so the next level can reuse them
+        [[nodiscard]] bool isHidden() const { return store.hasFlag(handle.index, EntityStore::HIDDEN); }
+
         // Collision detection using basic rectangle intersection
         [[nodiscard]] bool intersects(const Entity& other) const;
+
+    protected:
+        // Subclasses with their own columns in the store (Ghost) write them through this
+        [[nodiscard]] EntityStore& getMutableStore() { return store; }
+
+        // Setters publish DirectionChanged / ModeChanged only when the value changes
+        void setDirection(char dir);
+        void setMoving(bool moving) { store.setFlag(handle.index, EntityStore::MOVING, moving); }
+        void setStateInt(int state);
+        void setStateTimer(float timer) { store.setTimer(handle.index, timer); }
+        void setDying(bool dying) { store.setFlag(handle.index, EntityStore::DYING, dying); }
+        void setHidden(bool hidden) { store.setFlag(handle.index, EntityStore::HIDDEN, hidden); }
     };
 }
 
-#endif //PACMAN_RETRY_ENTITY_H
\ No newline at end of file
+#endif //PACMAN_RETRY_ENTITY_H
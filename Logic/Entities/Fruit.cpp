@@ -1,11 +0,0 @@
-//
-// Created by etienne on 12/7/25.
-//
-
-#include "Fruit.h"
-
-namespace Logic {
-    void Fruit::update() const {
-        notify();
-    }
-}
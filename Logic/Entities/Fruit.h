@@ -9,8 +9,15 @@
 namespace Logic {
     class Fruit final : public Entity {
     public:
-        Fruit(const float x, const float y, const float width, const float height) : Entity(x, y, width, height) {}
-        void update() const;
+        Fruit(EntityStore& store, const float x, const float y, const float width, const float height)
+            : Entity(store, EntityKind::Fruit, x, y, width, height) {}
+
+        // Hides the fruit and publishes FruitCollected; World keeps it for the next level
+        void collect() {
+            setHidden(true);
+            notify(EventType::FruitCollected);
+        }
+        void reset() { setHidden(false); }
     };
 }
 #endif //PACMAN_RETRY_FRUIT_H
\ No newline at end of file
@@ -1,18 +1,26 @@
 // Logic/Entities/Ghost.cpp
 #include "Ghost.h"
+#include "GhostsTypes.h"
 #include "Pacman.h"
+#include "../Log.h"
 #include <cmath>
-#include <algorithm>
-#include <iostream>
-#include "../Stopwatch.h"
 
 namespace Logic {
 
-    Ghost::Ghost(float x, float y, float width, float height, float waitTime, int id)
-        : Entity(x, y, width, height), state(GhostState::WAITING), startX(x), startY(y),
-          spawnTimer(waitTime), originalSpawnTime(waitTime), spriteId(id) {}
+    Ghost::Ghost(EntityStore& store, float x, float y, float width, float height, float waitTime, int id,
+                 GhostBrain brain)
+        : Entity(store, EntityKind::Ghost, x, y, width, height), spriteId(id) {
+        const std::uint32_t row = getHandle().index;
+        store.setSpeed(row, 0.30f);
+        store.setBaseSpeed(row, 0.30f);
+        store.setSpawnTimer(row, waitTime);
+        store.setSpawnTime(row, waitTime); // Original wait time for respawning
+        store.setHome(row, x, y);
+        store.setBrain(row, brain);
+        setState(GhostState::WAITING);
+    }
 
-    char Ghost::getOppositeDirection() const {
+    char Ghost::getOppositeDirection(const char direction) {
         switch(direction) {
             case 'U': return 'D';
             case 'D': return 'U';
@@ -24,37 +32,53 @@ namespace Logic {
 
     void Ghost::setFeared(float duration) {
         // Only switch if we are alive and active
-        if (state != GhostState::DEAD && state != GhostState::WAITING) {
-            state = GhostState::FEARED;
-            fearedTimer = duration;
-            speed = baseSpeed * 0.5f; // Slower
+        if (getState() != GhostState::DEAD && getState() != GhostState::WAITING) {
+            EntityStore& store = getMutableStore();
+            const std::uint32_t row = getHandle().index;
+            setState(GhostState::FEARED);
+            setStateTimer(duration);
+            store.setSpeed(row, store.getBaseSpeed(row) * 0.5f); // Slower
 
             // Requirement: "Reverses their direction" immediately
-            direction = getOppositeDirection();
+            setDirection(getOppositeDirection());
         }
     }
 
     void Ghost::die() {
-        state = GhostState::DEAD;
-        speed = baseSpeed * 2.5f; // Move fast to respawn
+        EntityStore& store = getMutableStore();
+        const std::uint32_t row = getHandle().index;
+        setState(GhostState::DEAD);
+        // Move fast to respawn: 6.25x base speed, the 2.5x die speed times the 2.5x boost the old
+        // straight-line return applied on top of it
+        store.setSpeed(row, store.getBaseSpeed(row) * 6.25f);
+        notify(EventType::GhostEaten);
         // Visuals usually hide the body here, leaving only eyes
     }
 
     void Ghost::despawn() {
         // Called immediately when Pacman dies - makes ghost invisible
-        state = GhostState::DESPAWNED;
-        direction = ' ';
+        setState(GhostState::DESPAWNED);
+        setDirection(' ');
     }
 
     void Ghost::resetForPacmanDeath() {
         // Called after death animation completes - reset ghost to spawn with wait timer
-        std::cout << "Ghost resetting - position (" << startX << ", " << startY << "), state: WAITING" << std::endl;
-        state = GhostState::WAITING;
-        speed = baseSpeed;
-        setPosition(startX, startY);
-        direction = ' ';
-        spawnTimer = originalSpawnTime; // Restore original wait time
-        fearedTimer = 0.0f; // Clear any feared state
+        EntityStore& store = getMutableStore();
+        const std::uint32_t row = getHandle().index;
+        LOG_DEBUG(Entity) << "Ghost resetting - position (" << store.getHomeX(row) << ", " << store.getHomeY(row)
+                          << "), state: WAITING";
+        setState(GhostState::WAITING);
+        store.setSpeed(row, store.getBaseSpeed(row));
+        snapTo(store.getHomeX(row), store.getHomeY(row));
+        setDirection(' ');
+        store.setSpawnTimer(row, store.getSpawnTime(row)); // Restore original wait time
+        setStateTimer(0.0f); // Clear any feared state
+    }
+
+    void Ghost::setBaseSpeed(const float newSpeed) {
+        EntityStore& store = getMutableStore();
+        store.setBaseSpeed(getHandle().index, newSpeed);
+        store.setSpeed(getHandle().index, newSpeed);
     }
 
 
@@ -66,120 +90,188 @@ namespace Logic {
     }
 
     // De standaard update loop die ALLE ghosts gebruiken
-    void Ghost::update(const std::vector<char> &valid, const std::shared_ptr<Pacman> &pacman) {
-        float dt = Stopwatch::getInstance().getDeltaTime();
+    EventMask Ghost::step(EntityStore& store, const std::uint32_t row, const std::uint8_t exits, const GhostContext &context) {
+        const float dt = context.deltaTime;
+
+        // Same rules as the Entity setters: an event for every value that actually changed
+        EventMask changed = 0;
+        const auto setState = [&](const GhostState state) {
+            if (store.getState(row) == static_cast<int>(state)) return;
+            store.setState(row, static_cast<int>(state));
+            changed |= eventBit(EventType::ModeChanged);
+        };
+        const auto setDirection = [&](const char direction) {
+            if (store.getDirection(row) == direction) return;
+            store.setDirection(row, direction);
+            changed |= eventBit(EventType::DirectionChanged);
+        };
+        const auto setPosition = [&](const float newX, const float newY) {
+            if (store.getX(row) == newX && store.getY(row) == newY) return;
+            store.setPosition(row, newX, newY);
+            changed |= eventBit(EventType::EntityMoved);
+        };
 
         // 1. STATE HANDLING
-        if (state == GhostState::DESPAWNED) {
+        if (store.getState(row) == static_cast<int>(GhostState::DESPAWNED)) {
             // Ghost is hidden - do nothing
-            notify(); // Still notify so view can handle invisibility
-            return;
+            return changed;
         }
 
-        if (state == GhostState::WAITING) {
-            spawnTimer -= dt;
-            if (spawnTimer <= 0) state = GhostState::CHASING;
-            else return;
-        } else if (state == GhostState::FEARED) {
-            fearedTimer -= dt;
-            if (fearedTimer <= 0) {
-                state = GhostState::CHASING;
-                speed = baseSpeed;
-            }
-        } else if (state == GhostState::DEAD) {
-            // Dead logic - ghost eaten by Pacman, returning to spawn
-            float dx = startX - getX();
-            float dy = startY - getY();
-            float dist = std::sqrt(dx*dx + dy*dy);
-            if (dist < 0.1f) {
-                // Reached spawn - go straight to CHASING (no wait!)
-                state = GhostState::CHASING;
-                speed = baseSpeed;
-                setPosition(startX, startY);
-                direction = ' ';
-                // NO waiting when eaten by Pacman
-            } else {
-                float move = speed * 2.5f * dt; // Fast return to spawn
-                setPosition(getX() + (dx/dist)*move, getY() + (dy/dist)*move);
+        if (store.getState(row) == static_cast<int>(GhostState::WAITING)) {
+            store.setSpawnTimer(row, store.getSpawnTimer(row) - dt);
+            if (store.getSpawnTimer(row) <= 0) setState(GhostState::CHASING);
+            else return changed;
+        } else if (store.getState(row) == static_cast<int>(GhostState::FEARED)) {
+            store.setTimer(row, store.getTimer(row) - dt);
+            if (store.getTimer(row) <= 0) {
+                setState(GhostState::CHASING);
+                store.setSpeed(row, store.getBaseSpeed(row));
             }
-            notify();
-            return;
         }
+        // DEAD: eaten by Pacman, walks to the nearest spawn along context.homeField at die() speed
 
         // 2. KIES EERSTE RICHTING
-        if (direction == ' ') {
-             // Als we bang zijn, kies random, anders vraag het brein
-             if (state == GhostState::FEARED) direction = pickRandomDirection(valid);
-             else direction = decideDirection(valid, pacman);
+        if (store.getDirection(row) == ' ') {
+            setDirection(chooseDirection(store, row, exits, context));
         }
 
         // 3. POSITIE BEREKENINGEN
-        float tileW = getWidth();
-        float tileH = getHeight();
-        float centerX = getGridCenter(getX(), tileW);
-        float centerY = getGridCenter(getY(), tileH);
-        float moveDist = speed * dt;
+        float x = store.getX(row);
+        float y = store.getY(row);
+        float centerX = getGridCenter(x, store.getWidth(row));
+        float centerY = getGridCenter(y, store.getHeight(row));
+        float moveDist = store.getSpeed(row) * dt;
 
         bool approachingCenter = false;
         float distRemaining = 0.0f;
 
-        switch (direction) {
-            case 'U': approachingCenter = (getY() > centerY); distRemaining = std::abs(getY() - centerY); break;
-            case 'D': approachingCenter = (getY() < centerY); distRemaining = std::abs(getY() - centerY); break;
-            case 'L': approachingCenter = (getX() > centerX); distRemaining = std::abs(getX() - centerX); break;
-            case 'R': approachingCenter = (getX() < centerX); distRemaining = std::abs(getX() - centerX); break;
+        switch (store.getDirection(row)) {
+            case 'U': approachingCenter = (y > centerY); distRemaining = std::abs(y - centerY); break;
+            case 'D': approachingCenter = (y < centerY); distRemaining = std::abs(y - centerY); break;
+            case 'L': approachingCenter = (x > centerX); distRemaining = std::abs(x - centerX); break;
+            case 'R': approachingCenter = (x < centerX); distRemaining = std::abs(x - centerX); break;
         }
 
-        bool isBlocked = std::find(valid.begin(), valid.end(), direction) == valid.end();
+        bool isBlocked = (exits & Exits::bit(store.getDirection(row))) == 0;
+
+        // Reached a spawn tile while dead: revive on the spot (NO waiting when eaten by Pacman).
+        // homeField is rooted at every spawn, so this is the nearest spawn tile, not necessarily
+        // the ghost's own; after Pacman dies resetForPacmanDeath() still sends it to its own.
+        const bool atHome = store.getState(row) == static_cast<int>(GhostState::DEAD) &&
+                            context.homeField.at(context.tileX, context.tileY) == 0;
+        const auto revive = [&] {
+            // Back home - go straight to CHASING (no wait!)
+            setState(GhostState::CHASING);
+            store.setSpeed(row, store.getBaseSpeed(row));
+            setDirection(' ');
+        };
 
         // 4. KRUISPUNT OF BLOKKADE LOGICA
         if (isBlocked && !approachingCenter) {
             setPosition(centerX, centerY);
+            if (atHome) {
+                revive();
+                return changed;
+            }
 
-            // HIER IS HET VERSCHIL: We roepen de virtuele functie aan
-            if (state == GhostState::FEARED) direction = pickRandomDirection(valid);
-            else direction = decideDirection(valid, pacman);
+            setDirection(chooseDirection(store, row, exits, context));
 
-            notify();
-            return;
+            return changed;
         }
 
         if (approachingCenter && moveDist >= distRemaining) {
-            setPosition(centerX, centerY);
+            x = centerX;
+            y = centerY;
+            if (atHome) {
+                setPosition(x, y);
+                revive();
+                return changed;
+            }
             float overshoot = moveDist - distRemaining;
 
-            // OOK HIER: Vraag het brein om advies
-            if (state == GhostState::FEARED) direction = pickRandomDirection(valid);
-            else direction = decideDirection(valid, pacman);
+            setDirection(chooseDirection(store, row, exits, context));
 
-            switch (direction) {
-                case 'U': setPosition(getX(), getY() - overshoot); break;
-                case 'D': setPosition(getX(), getY() + overshoot); break;
-                case 'L': setPosition(getX() - overshoot, getY()); break;
-                case 'R': setPosition(getX() + overshoot, getY()); break;
+            switch (store.getDirection(row)) {
+                case 'U': y -= overshoot; break;
+                case 'D': y += overshoot; break;
+                case 'L': x -= overshoot; break;
+                case 'R': x += overshoot; break;
             }
         } else {
             // Gewoon doorlopen
-            float nextX = getX();
-            float nextY = getY();
-            switch (direction) {
-                case 'U': nextY -= moveDist; break;
-                case 'D': nextY += moveDist; break;
-                case 'L': nextX -= moveDist; break;
-                case 'R': nextX += moveDist; break;
+            switch (store.getDirection(row)) {
+                case 'U': y -= moveDist; break;
+                case 'D': y += moveDist; break;
+                case 'L': x -= moveDist; break;
+                case 'R': x += moveDist; break;
             }
-            setPosition(nextX, nextY);
         }
 
         // Axis locking
-        if (direction == 'U' || direction == 'D') setPosition(centerX, getY());
-        else if (direction == 'L' || direction == 'R') setPosition(getX(), centerY);
+        if (store.getDirection(row) == 'U' || store.getDirection(row) == 'D') x = centerX;
+        else if (store.getDirection(row) == 'L' || store.getDirection(row) == 'R') y = centerY;
+        setPosition(x, y);
+        return changed;
+    }
+
+    char Ghost::followField(const DistanceField& field, const std::uint8_t exits, const GhostContext& context) {
+        std::uint16_t minDistance = DistanceField::UNREACHABLE;
+        char bestMoves[4];
+        int bestCount = 0;
+
+        for (char move : Exits::LETTERS) {
+            if ((exits & Exits::bit(move)) == 0) continue;
 
-        notify();
+            int nextX = context.tileX;
+            int nextY = context.tileY;
+
+            // Simuleer 1 stap
+            switch(move) {
+                case 'U': nextY--; break;
+                case 'D': nextY++; break;
+                case 'L': nextX--; break;
+                case 'R': nextX++; break;
+            }
+
+            const std::uint16_t dist = field.at(nextX, nextY);
+            if (dist < minDistance) {
+                minDistance = dist;
+                bestMoves[0] = move;
+                bestCount = 1;
+            } else if (dist == minDistance && dist != DistanceField::UNREACHABLE) {
+                bestMoves[bestCount++] = move;
+            }
+        }
+
+        // Target cut off (or no field yet): wander
+        if (bestCount == 0) return pickRandomDirection(exits, context.rng);
+        if (bestCount == 1) return bestMoves[0];
+        // Ties broken at random
+        return bestMoves[context.rng.nextInt(0, bestCount - 1)];
+    }
+
+    char Ghost::chooseDirection(const EntityStore& store, const std::uint32_t row, const std::uint8_t exits,
+                                const GhostContext& context) {
+        // Junctions always leave a choice. Elsewhere (corridor, corner, dead end) a moving ghost has
+        // one way on once World masked off its reverse; dead or standing ghosts may still have two
+        if ((exits & Exits::JUNCTION) == 0 && Exits::count(exits) <= 1) return Exits::first(exits);
+
+        // Eaten: the home field leads back to the ghost house
+        if (store.getState(row) == static_cast<int>(GhostState::DEAD)) return followField(context.homeField, exits, context);
+
+        // Als we bang zijn, kies random, anders vraag het brein
+        if (store.getState(row) == static_cast<int>(GhostState::FEARED)) return pickRandomDirection(exits, context.rng);
+        switch (store.getBrain(row)) {
+            case GhostBrain::Locked: return RedGhost::decideDirection(store, row, exits, context);
+            case GhostBrain::Ambush: return PinkGhost::decideDirection(store, row, exits, context);
+            case GhostBrain::Chase: return OrangeGhost::decideDirection(store, row, exits, context);
+        }
+        return ' ';
     }
 
-    char Ghost::pickRandomDirection(const std::vector<char>& valid) {
-        if (valid.empty()) return ' ';
-        return valid[Random::getInstance().nextInt(0, valid.size() - 1)];
+    char Ghost::pickRandomDirection(const std::uint8_t exits, Random& rng) {
+        const int options = Exits::count(exits);
+        if (options == 0) return ' ';
+        return Exits::nth(exits, rng.nextInt(0, options - 1));
     }
 }
\ No newline at end of file
@@ -6,11 +6,25 @@
 #include <vector>
 #include <memory>
 #include <cmath>
+#include <cstdint>
+#include "../DistanceField.h"
 #include "../Random.h"
+#include "../TileGrid.h"
 
 namespace Logic {
     class Pacman;
-    class Wall;
+
+    // Everything a ghost reads from its World during one tick
+    struct GhostContext {
+        const Pacman& pacman;
+        float deltaTime;
+        Random& rng;  // The World's generator, so runs replay from a seed
+        const DistanceField& chaseField;   // Maze distances to Pacman's tile
+        const DistanceField& ambushField;  // Maze distances to the tile Pacman is heading for
+        const DistanceField& homeField;    // Maze distances to the nearest ghost spawn tile
+        int tileX;  // Tile the ghost is on
+        int tileY;
+    };
 
     enum class GhostState {
         WAITING,
@@ -20,44 +34,50 @@ namespace Logic {
         DESPAWNED  // Hidden when Pacman dies
     };
 
+    // Handle to a ghost row for views and the rare events (fear, eaten, Pacman died).
+    // Speed, spawn wait, home and brain live in the EntityStore row next to state,
+    // direction and feared timer; the per-tick movement is step(), run by World over
+    // EntityStore::ghostRows(). step() returns what changed, and World publishes those
+    // events on the handle like the Entity setters would.
     class Ghost : public Entity {
     protected:
-        GhostState state;
-        char direction = ' ';
-        float speed = 0.30f;
-        float baseSpeed = 0.30f;
         int spriteId; // 0=Red, 1=Pink, 2=Blue, 3=Orange
 
-        float startX, startY;
-        float spawnTimer;
-        float originalSpawnTime; // Store original wait time for respawning
-        float fearedTimer = 0.0f;
+        void setState(GhostState newState) { setStateInt(static_cast<int>(newState)); }
 
         // Helper voor random keuze (handig voor FEARED state)
-        static char pickRandomDirection(const std::vector<char>& valid) ;
+        static char pickRandomDirection(std::uint8_t exits, Random& rng);
+
+        // Exit whose neighbouring tile is closest to the field's root (ties at random)
+        static char followField(const DistanceField& field, std::uint8_t exits, const GhostContext& context);
 
-        // DIT MOET ELKE GHOST ZELF INVULLEN (Het brein)
-        virtual char decideDirection(const std::vector<char>& valid, std::shared_ptr<Pacman> pacman) = 0;
+        // Corridors and corners have one way on; only real choices reach the ghost's brain
+        static char chooseDirection(const EntityStore& store, std::uint32_t row, std::uint8_t exits,
+                                    const GhostContext& context);
 
     public:
-        [[nodiscard]] char getOppositeDirection() const;
-        Ghost(float x, float y, float width, float height, float waitTime, int spriteId);
+        Ghost(EntityStore& store, float x, float y, float width, float height, float waitTime, int spriteId,
+              GhostBrain brain);
         ~Ghost() override = default;
-        virtual void update(const std::vector<char> &valid, const std::shared_ptr<Pacman> &pacman);
+
+        [[nodiscard]] static char getOppositeDirection(char direction);
+        [[nodiscard]] char getOppositeDirection() const { return getOppositeDirection(getDirection()); }
+
+        // Advances the ghost in one store row by context.deltaTime
+        // exits: Exits:: mask of the current tile, reverse already removed when moving
+        // Returns EntityMoved / DirectionChanged / ModeChanged bits for the values that changed
+        static EventMask step(EntityStore& store, std::uint32_t row, std::uint8_t exits, const GhostContext& context);
+
         void setFeared(float duration);
         void die();
 
         // Override Entity's virtual methods for polymorphic access
-        [[nodiscard]] char getDirection() const override { return direction; }
-        [[nodiscard]] bool isMoving() const override { return direction != ' '; }
-        [[nodiscard]] int getStateInt() const override { return static_cast<int>(state); }
-        [[nodiscard]] float getStateTimer() const override { return fearedTimer; }
         [[nodiscard]] int getSpriteId() const override { return spriteId; }
 
         // Ghost-specific getters (for logic layer use)
-        [[nodiscard]] GhostState getState() const { return state; }
-        [[nodiscard]] float getSpeed() const { return speed; }
-        [[nodiscard]] float getFearedTimer() const { return fearedTimer; }
+        [[nodiscard]] GhostState getState() const { return static_cast<GhostState>(getStateInt()); }
+        [[nodiscard]] float getSpeed() const { return getStore().getSpeed(getHandle().index); }
+        [[nodiscard]] float getFearedTimer() const { return getStateTimer(); }
 
         // Despawn ghost when Pacman dies (makes invisible)
         void despawn();
@@ -66,7 +86,7 @@ namespace Logic {
         void resetForPacmanDeath();
 
         // Set base speed (for difficulty scaling)
-        void setBaseSpeed(float newSpeed) { baseSpeed = newSpeed; speed = newSpeed; }
+        void setBaseSpeed(float newSpeed);
     };
 }
 #endif //PACMAN_RETRY_GHOST_H
\ No newline at end of file
@@ -6,36 +6,38 @@
 
 namespace Logic {
 
+    // Each type only sets up its row; the brains are static so Ghost::step can
+    // call them on a store row without a virtual call through the object
+
     // --- GHOST 1: RED (Locked / Random) ---
     class RedGhost : public Ghost {
     public:
         // Start direct (0s), spriteId = 0 (Red)
-        RedGhost(float x, float y, float w, float h) : Ghost(x, y, w, h, 0.0f, 0) {}
-        char decideDirection(const std::vector<char> &valid, std::shared_ptr<Pacman> pacman) override;
+        RedGhost(EntityStore& store, float x, float y, float w, float h) : Ghost(store, x, y, w, h, 0.0f, 0, GhostBrain::Locked) {}
+        static char decideDirection(const EntityStore& store, std::uint32_t row, std::uint8_t exits, const GhostContext &context);
     };
 
     // --- GHOST 2: PINK (In Front of Pacman) ---
     class PinkGhost : public Ghost {
     public:
         // Start direct (0s), spriteId = 1 (Pink)
-        PinkGhost(float x, float y, float w, float h) : Ghost(x, y, w, h, 0.0f, 1) {}
-        char decideDirection(const std::vector<char> &valid, std::shared_ptr<Pacman> pacman) override;
+        PinkGhost(EntityStore& store, float x, float y, float w, float h) : Ghost(store, x, y, w, h, 0.0f, 1, GhostBrain::Ambush) {}
+        static char decideDirection(const EntityStore& store, std::uint32_t row, std::uint8_t exits, const GhostContext &context);
     };
 
     // --- GHOST 3: BLUE (In Front of Pacman - Delayed) ---
     class BlueGhost : public Ghost {
     public:
-        // Start na 5 seconden, spriteId = 2 (Blue)
-        BlueGhost(float x, float y, float w, float h) : Ghost(x, y, w, h, 5.0f, 2) {}
-        char decideDirection(const std::vector<char> &valid, std::shared_ptr<Pacman> pacman) override;
+        // Start na 5 seconden, spriteId = 2 (Blue); same brain as Pink
+        BlueGhost(EntityStore& store, float x, float y, float w, float h) : Ghost(store, x, y, w, h, 5.0f, 2, GhostBrain::Ambush) {}
     };
 
     // --- GHOST 4: ORANGE (Direct Chase - Delayed) ---
     class OrangeGhost : public Ghost {
     public:
         // Start na 10 seconden, spriteId = 3 (Orange)
-        OrangeGhost(float x, float y, float w, float h) : Ghost(x, y, w, h, 10.0f, 3) {}
-        char decideDirection(const std::vector<char> &valid, std::shared_ptr<Pacman> pacman) override;
+        OrangeGhost(EntityStore& store, float x, float y, float w, float h) : Ghost(store, x, y, w, h, 10.0f, 3, GhostBrain::Chase) {}
+        static char decideDirection(const EntityStore& store, std::uint32_t row, std::uint8_t exits, const GhostContext &context);
     };
 
 }
@@ -1,37 +1,38 @@
 // Logic/Entities/Pacman.cpp
 #include "Pacman.h"
-#include <iostream>
+#include "../Log.h"
 
 namespace Logic {
 
     void Pacman::setDirection(const char dir) {
-        if (dying) return; // Can't change direction while dying
+        if (isDying()) return; // Can't change direction while dying
         if (dir == 'U' || dir == 'D' || dir == 'L' || dir == 'R' || dir == ' ') {
-            direction = dir;
+            Entity::setDirection(dir);
         }
     }
 
     void Pacman::queueDirection(const char dir) {
-        if (dying) return; // Can't queue direction while dying
+        if (isDying()) return; // Can't queue direction while dying
         if (dir == 'U' || dir == 'D' || dir == 'L' || dir == 'R') {
             directionBuffer = dir;
         }
     }
 
     void Pacman::die() {
-        if (dying) return; // Already dying
+        if (isDying()) return; // Already dying
 
-        dying = true;
+        setDying(true);
         deathTimer = 0.0f;
-        direction = ' ';
-        moving = false;
+        Entity::setDirection(' ');
+        setMoving(false);
         lives--;
+        notify(EventType::EntityDied);
 
-        std::cout << "Pacman died! Lives remaining: " << lives << std::endl;
+        LOG_INFO(Entity) << "Pacman died! Lives remaining: " << lives;
     }
 
     void Pacman::updateDeath(float deltaTime) {
-        if (!dying) return;
+        if (!isDying()) return;
 
         deathTimer += deltaTime;
 
@@ -44,27 +45,27 @@ namespace Logic {
     }
 
     void Pacman::respawn() {
-        dying = false;
+        setDying(false);
         deathTimer = 0.0f;
-        direction = ' ';
+        Entity::setDirection(' ');
         directionBuffer = ' ';
-        moving = false;
+        setMoving(false);
 
         // Return to spawn position
-        setPosition(spawnX, spawnY);
+        snapTo(spawnX, spawnY);
 
-        std::cout << "Pacman respawned at (" << spawnX << ", " << spawnY << ")" << std::endl;
+        LOG_DEBUG(Entity) << "Pacman respawned at (" << spawnX << ", " << spawnY << ")";
     }
 
     void Pacman::update(const float deltaTime) {
         // If dying, only update death animation
-        if (dying) {
+        if (isDying()) {
             updateDeath(deltaTime);
-            notify();
             return;
         }
 
         // If we have no direction, do nothing
+        const char direction = getDirection();
         if (direction == ' ') return;
 
         const float distance = speed * deltaTime;
@@ -83,7 +84,6 @@ namespace Logic {
 
         // Move unconditionally (World will revert if we hit a wall)
         setPosition(nextX, nextY);
-        moving = true;
-        notify();
+        setMoving(true);
     }
 }
\ No newline at end of file
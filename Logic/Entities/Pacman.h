@@ -7,14 +7,13 @@
 namespace Logic {
     class Pacman final : public Entity {
     private:
-        char direction = ' ';
+        // Direction, moving and dying live in the EntityStore row
         char directionBuffer = ' '; // Stores the next intended move
         float speed = 0.5f;
-        bool moving = false;
 
         // Lives and death
-        int lives = 3;
-        bool dying = false;
+        static constexpr int START_LIVES = 3;
+        int lives = START_LIVES;
         float deathTimer = 0.0f;
         const float deathAnimationDuration = 1.0f; // Total death animation time
 
@@ -22,21 +21,20 @@ namespace Logic {
         float spawnX, spawnY;
 
     public:
-        Pacman(const float x, const float y, const float width, const float height)
-            : Entity(x, y, width, height), spawnX(x), spawnY(y) {}
+        Pacman(EntityStore& store, const float x, const float y, const float width, const float height)
+            : Entity(store, EntityKind::Pacman, x, y, width, height), spawnX(x), spawnY(y) {}
 
-        [[nodiscard]] char getDirection() const override { return direction; }
-        [[nodiscard]] bool isMoving() const override { return moving; }
-        void setMoving(const bool move) { moving = move; }
+        using Entity::setMoving;
         [[nodiscard]] char getQueuedDirection() const { return directionBuffer; }
         [[nodiscard]] float getSpeed() const { return speed; }
 
         // Death and lives
-        [[nodiscard]] bool isDying() const override { return dying; }
         [[nodiscard]] int getLives() const override { return lives; }
         [[nodiscard]] float getDeathTimer() const { return deathTimer; }
         void die();
         void respawn();
+        // Every level starts with full lives, as when each level built a new Pacman
+        void resetLives() { lives = START_LIVES; }
         void updateDeath(float deltaTime);
         [[nodiscard]] bool isDeathAnimationComplete() const;
 
@@ -1,11 +0,0 @@
-//
-// Created by etienne on 12/7/25.
-//
-
-#include "Wall.h"
-
-namespace Logic {
-    void Wall::update() const {
-        notify();
-    }
-}
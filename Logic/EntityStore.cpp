@@ -0,0 +1,98 @@
+// Logic/EntityStore.cpp
+#include "EntityStore.h"
+
+#include <algorithm>
+
+namespace Logic {
+
+    EntityHandle EntityStore::create(const EntityKind kind, const float x, const float y, const float width, const float height) {
+        std::uint32_t row;
+        if (!freeRows.empty()) {
+            row = freeRows.back();
+            freeRows.pop_back();
+        } else {
+            row = static_cast<std::uint32_t>(xs.size());
+            xs.emplace_back();
+            ys.emplace_back();
+            prevXs.emplace_back();
+            prevYs.emplace_back();
+            widths.emplace_back();
+            heights.emplace_back();
+            kinds.emplace_back();
+            states.emplace_back();
+            timers.emplace_back();
+            directions.emplace_back();
+            flags.emplace_back();
+            generations.emplace_back(0);
+            speeds.emplace_back();
+            baseSpeeds.emplace_back();
+            spawnTimers.emplace_back();
+            spawnTimes.emplace_back();
+            homeXs.emplace_back();
+            homeYs.emplace_back();
+            brains.emplace_back();
+        }
+
+        xs[row] = prevXs[row] = x;
+        ys[row] = prevYs[row] = y;
+        widths[row] = width;
+        heights[row] = height;
+        kinds[row] = kind;
+        states[row] = -1;
+        timers[row] = 0.0f;
+        directions[row] = ' ';
+        flags[row] = ALIVE;
+        speeds[row] = baseSpeeds[row] = 0.0f;
+        spawnTimers[row] = spawnTimes[row] = 0.0f;
+        homeXs[row] = x;
+        homeYs[row] = y;
+        brains[row] = GhostBrain::Locked;
+        if (kind == EntityKind::Ghost) ghostRowList.push_back(row);
+        if (kind == EntityKind::Pacman || kind == EntityKind::Ghost) movingRowList.push_back(row);
+        liveCount++;
+
+        return {row, generations[row]};
+    }
+
+    void EntityStore::destroy(const EntityHandle handle) {
+        if (!isValid(handle)) return;
+
+        if (kinds[handle.index] == EntityKind::Ghost) {
+            // Erase, not swap-and-pop: the list keeps creation order
+            ghostRowList.erase(std::find(ghostRowList.begin(), ghostRowList.end(), handle.index));
+        }
+        if (kinds[handle.index] == EntityKind::Pacman || kinds[handle.index] == EntityKind::Ghost) {
+            movingRowList.erase(std::find(movingRowList.begin(), movingRowList.end(), handle.index));
+        }
+        flags[handle.index] = 0;
+        generations[handle.index]++;  // Outstanding handles to this row go stale
+        freeRows.push_back(handle.index);
+        liveCount--;
+    }
+
+    void EntityStore::storePreviousPositions() {
+        for (const std::uint32_t row : movingRowList) {
+            prevXs[row] = xs[row];
+            prevYs[row] = ys[row];
+        }
+    }
+
+    void EntityStore::copyTickTo(EntityStore& into) const {
+        if (into.rowCount() != rowCount()) {
+            into = *this;
+            return;
+        }
+
+        for (const std::uint32_t row : movingRowList) {
+            into.xs[row] = xs[row];
+            into.ys[row] = ys[row];
+            into.prevXs[row] = prevXs[row];
+            into.prevYs[row] = prevYs[row];
+            into.states[row] = states[row];
+            into.timers[row] = timers[row];
+            into.directions[row] = directions[row];
+        }
+        std::copy(flags.begin(), flags.end(), into.flags.begin());
+        std::copy(generations.begin(), generations.end(), into.generations.begin());
+    }
+}
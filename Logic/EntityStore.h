@@ -0,0 +1,207 @@
+// Logic/EntityStore.h
+#ifndef PACMAN_RETRY_ENTITYSTORE_H
+#define PACMAN_RETRY_ENTITYSTORE_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file EntityStore.h
+ * @brief Contiguous structure-of-arrays storage for entity data
+ *
+ * Every entity's transform and the state its view draws from (direction,
+ * ghost state, timer, flags) live in parallel arrays here instead of inside
+ * the entity objects. Per-tick passes over all entities, like saving the
+ * interpolation start positions, then walk a few tightly packed float arrays
+ * instead of chasing one heap object per entity.
+ *
+ * Ghosts keep their movement data (speed, spawn wait, home position, AI
+ * brain) in columns here as well, and the store lists the ghost rows in
+ * creation order, so World steps every ghost in one loop over the store
+ * without touching the Ghost objects.
+ *
+ * Entities and views refer to their row through an EntityHandle. Rows are
+ * reused after an entity is destroyed; the generation counter in the handle
+ * makes a stale handle to a reused row detectably invalid.
+ */
+
+namespace Logic {
+
+    /**
+     * @brief What an entity row belongs to
+     */
+    enum class EntityKind : std::uint8_t {
+        Pacman,
+        Ghost,
+        Coin,
+        Fruit
+    };
+
+    /**
+     * @brief How a ghost picks its way at a junction
+     */
+    enum class GhostBrain : std::uint8_t {
+        Locked,  ///< Keeps going straight or turns at random (Red)
+        Ambush,  ///< Heads for the tiles ahead of Pacman (Pink, Blue)
+        Chase    ///< Heads for Pacman's tile (Orange)
+    };
+
+    /**
+     * @struct EntityHandle
+     * @brief Stable reference to one row of an EntityStore
+     */
+    struct EntityHandle {
+        std::uint32_t index = UINT32_MAX;  ///< Row in the store
+        std::uint32_t generation = 0;      ///< Must match the row's generation to be valid
+
+        bool operator==(const EntityHandle&) const = default;
+    };
+
+    /**
+     * @class EntityStore
+     * @brief Parallel arrays holding the data of every entity in a World
+     *
+     * Row accessors take the index of a valid handle and do no checking;
+     * use isValid() first when a handle may have outlived its entity.
+     */
+    class EntityStore {
+    public:
+        // Bits of the flags array
+        static constexpr std::uint8_t ALIVE = 1;   ///< Row is in use
+        static constexpr std::uint8_t MOVING = 2;  ///< Entity moved this tick (drives Pacman's mouth animation)
+        static constexpr std::uint8_t DYING = 4;   ///< Death animation is playing
+        static constexpr std::uint8_t HIDDEN = 8;  ///< Kept for reuse but not in play (collected pickups)
+
+    private:
+        std::vector<float> xs;
+        std::vector<float> ys;
+        std::vector<float> prevXs;                ///< Position at the start of the current tick
+        std::vector<float> prevYs;
+        std::vector<float> widths;
+        std::vector<float> heights;
+        std::vector<EntityKind> kinds;
+        std::vector<std::int8_t> states;          ///< Ghost state as int, -1 for non-ghosts
+        std::vector<float> timers;                ///< Ghost feared timer
+        std::vector<char> directions;             ///< 'U', 'D', 'L', 'R' or ' '
+        std::vector<std::uint8_t> flags;
+        std::vector<std::uint32_t> generations;
+
+        // Ghost columns, unused by other kinds
+        std::vector<float> speeds;                ///< Current speed (normalized units per second)
+        std::vector<float> baseSpeeds;            ///< Speed when chasing; feared and dead speeds derive from it
+        std::vector<float> spawnTimers;           ///< Seconds left before a waiting ghost leaves home
+        std::vector<float> spawnTimes;            ///< Wait a ghost restarts with after Pacman died
+        std::vector<float> homeXs;                ///< Spawn position
+        std::vector<float> homeYs;
+        std::vector<GhostBrain> brains;
+
+        std::vector<std::uint32_t> ghostRowList;  ///< Rows of every ghost, in creation order
+        std::vector<std::uint32_t> movingRowList; ///< Rows of Pacman and the ghosts, the only entities that move
+        std::vector<std::uint32_t> freeRows;      ///< Released rows, reused before the arrays grow
+        std::size_t liveCount = 0;
+
+    public:
+        EntityStore() = default;
+
+        /**
+         * @brief Adds an entity row
+         * @return Handle to the new row
+         */
+        EntityHandle create(EntityKind kind, float x, float y, float width, float height);
+
+        /**
+         * @brief Releases a row; handles to it become invalid
+         */
+        void destroy(EntityHandle handle);
+
+        /**
+         * @brief Checks whether a handle still refers to a live row
+         */
+        [[nodiscard]] bool isValid(const EntityHandle handle) const {
+            return handle.index < generations.size() && generations[handle.index] == handle.generation &&
+                   (flags[handle.index] & ALIVE) != 0;
+        }
+
+        /**
+         * @brief Copies the position of every moving row into its previous position
+         *
+         * Called at the start of each logic tick so views can interpolate
+         * between the last two ticks. Coins and fruits never move, so their
+         * previous position keeps the value create() gave it.
+         */
+        void storePreviousPositions();
+
+        /**
+         * @brief Copies what can change during a tick into a copy of this store
+         * @param into Copy of this store taken since the last create() or destroy()
+         *
+         * Copies position, previous position, state, timer, direction and
+         * flags of the moving rows, and flags and generation of every row
+         * (collected pickups are hidden, not destroyed). Sizes, kinds and the
+         * ghost columns only change when entities are created or destroyed,
+         * so they are left alone. If the row counts differ, into gets a full
+         * copy instead.
+         */
+        void copyTickTo(EntityStore& into) const;
+
+        /**
+         * @brief Number of rows, including released ones (upper bound for linear passes)
+         */
+        [[nodiscard]] std::size_t rowCount() const { return xs.size(); }
+
+        /**
+         * @brief Number of live entities
+         */
+        [[nodiscard]] std::size_t size() const { return liveCount; }
+
+        /**
+         * @brief Rows of every live ghost, in the order the ghosts were created
+         *
+         * Stepping the ghosts in this order keeps a seeded game reproducible.
+         */
+        [[nodiscard]] const std::vector<std::uint32_t>& ghostRows() const { return ghostRowList; }
+
+        /**
+         * @brief Rows of Pacman and every ghost
+         */
+        [[nodiscard]] const std::vector<std::uint32_t>& movingRows() const { return movingRowList; }
+
+        // Row accessors
+        [[nodiscard]] float getX(const std::uint32_t row) const { return xs[row]; }
+        [[nodiscard]] float getY(const std::uint32_t row) const { return ys[row]; }
+        [[nodiscard]] float getPreviousX(const std::uint32_t row) const { return prevXs[row]; }
+        [[nodiscard]] float getPreviousY(const std::uint32_t row) const { return prevYs[row]; }
+        [[nodiscard]] float getWidth(const std::uint32_t row) const { return widths[row]; }
+        [[nodiscard]] float getHeight(const std::uint32_t row) const { return heights[row]; }
+        [[nodiscard]] EntityKind getKind(const std::uint32_t row) const { return kinds[row]; }
+        [[nodiscard]] int getState(const std::uint32_t row) const { return states[row]; }
+        [[nodiscard]] float getTimer(const std::uint32_t row) const { return timers[row]; }
+        [[nodiscard]] char getDirection(const std::uint32_t row) const { return directions[row]; }
+        [[nodiscard]] bool hasFlag(const std::uint32_t row, const std::uint8_t flag) const { return (flags[row] & flag) != 0; }
+        [[nodiscard]] float getSpeed(const std::uint32_t row) const { return speeds[row]; }
+        [[nodiscard]] float getBaseSpeed(const std::uint32_t row) const { return baseSpeeds[row]; }
+        [[nodiscard]] float getSpawnTimer(const std::uint32_t row) const { return spawnTimers[row]; }
+        [[nodiscard]] float getSpawnTime(const std::uint32_t row) const { return spawnTimes[row]; }
+        [[nodiscard]] float getHomeX(const std::uint32_t row) const { return homeXs[row]; }
+        [[nodiscard]] float getHomeY(const std::uint32_t row) const { return homeYs[row]; }
+        [[nodiscard]] GhostBrain getBrain(const std::uint32_t row) const { return brains[row]; }
+
+        void setPosition(const std::uint32_t row, const float x, const float y) { xs[row] = x; ys[row] = y; }
+        void setPreviousPosition(const std::uint32_t row, const float x, const float y) { prevXs[row] = x; prevYs[row] = y; }
+        void setSize(const std::uint32_t row, const float width, const float height) { widths[row] = width; heights[row] = height; }
+        void setState(const std::uint32_t row, const int state) { states[row] = static_cast<std::int8_t>(state); }
+        void setTimer(const std::uint32_t row, const float timer) { timers[row] = timer; }
+        void setDirection(const std::uint32_t row, const char direction) { directions[row] = direction; }
+        void setFlag(const std::uint32_t row, const std::uint8_t flag, const bool on) {
+            flags[row] = on ? (flags[row] | flag) : (flags[row] & ~flag);
+        }
+        void setSpeed(const std::uint32_t row, const float speed) { speeds[row] = speed; }
+        void setBaseSpeed(const std::uint32_t row, const float speed) { baseSpeeds[row] = speed; }
+        void setSpawnTimer(const std::uint32_t row, const float timer) { spawnTimers[row] = timer; }
+        void setSpawnTime(const std::uint32_t row, const float time) { spawnTimes[row] = time; }
+        void setHome(const std::uint32_t row, const float x, const float y) { homeXs[row] = x; homeYs[row] = y; }
+        void setBrain(const std::uint32_t row, const GhostBrain brain) { brains[row] = brain; }
+    };
+}
+
+#endif //PACMAN_RETRY_ENTITYSTORE_H
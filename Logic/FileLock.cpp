@@ -0,0 +1,71 @@
+// Logic/FileLock.cpp
+#include "FileLock.h"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+namespace Logic {
+
+#ifdef _WIN32
+    FileLock::FileLock(const std::string& path) {
+        const HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                                        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                                        OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Failed to open lock file: " + path);
+        }
+        handle = reinterpret_cast<std::intptr_t>(file);
+    }
+
+    FileLock::~FileLock() {
+        CloseHandle(reinterpret_cast<HANDLE>(handle));
+    }
+
+    void FileLock::lock(const bool exclusive) {
+        OVERLAPPED overlapped{};
+        const DWORD flags = exclusive ? LOCKFILE_EXCLUSIVE_LOCK : 0;
+        if (!LockFileEx(reinterpret_cast<HANDLE>(handle), flags, 0, MAXDWORD, MAXDWORD, &overlapped)) {
+            throw std::runtime_error("Failed to lock file");
+        }
+    }
+
+    void FileLock::unlock() {
+        OVERLAPPED overlapped{};
+        UnlockFileEx(reinterpret_cast<HANDLE>(handle), 0, MAXDWORD, MAXDWORD, &overlapped);
+    }
+#else
+    FileLock::FileLock(const std::string& path) {
+        const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            throw std::runtime_error("Failed to open lock file: " + path);
+        }
+        handle = fd;
+    }
+
+    FileLock::~FileLock() {
+        ::close(static_cast<int>(handle));
+    }
+
+    void FileLock::lock(const bool exclusive) {
+        // Retry if a signal interrupts the wait
+        while (::flock(static_cast<int>(handle), exclusive ? LOCK_EX : LOCK_SH) != 0) {
+            if (errno != EINTR) throw std::runtime_error("Failed to lock file");
+        }
+    }
+
+    void FileLock::unlock() {
+        ::flock(static_cast<int>(handle), LOCK_UN);
+    }
+#endif
+}
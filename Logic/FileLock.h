@@ -0,0 +1,58 @@
+// Logic/FileLock.h
+#ifndef PACMAN_RETRY_FILELOCK_H
+#define PACMAN_RETRY_FILELOCK_H
+
+#include <cstdint>
+#include <string>
+
+namespace Logic {
+
+    /**
+     * @class FileLock
+     * @brief Advisory lock on a file, shared between processes
+     *
+     * Uses flock() on POSIX systems and LockFileEx() on Windows. The lock
+     * file is created if needed and kept open for the lifetime of the
+     * object; lock() blocks until the lock is granted.
+     *
+     * Two FileLock objects on the same path exclude each other even within
+     * one process, but a single object must not be locked from two threads.
+     */
+    class FileLock {
+    private:
+        std::intptr_t handle;  ///< File descriptor or HANDLE
+
+    public:
+        /**
+         * @throws std::runtime_error if the lock file can't be opened
+         */
+        explicit FileLock(const std::string& path);
+        ~FileLock();
+
+        FileLock(const FileLock&) = delete;
+        FileLock& operator=(const FileLock&) = delete;
+
+        /**
+         * @param exclusive false for a shared (reader) lock
+         */
+        void lock(bool exclusive);
+        void unlock();
+
+        /**
+         * @brief Holds the lock for one scope
+         */
+        class Guard {
+        private:
+            FileLock& fileLock;
+
+        public:
+            Guard(FileLock& fileLock, const bool exclusive) : fileLock(fileLock) { fileLock.lock(exclusive); }
+            ~Guard() { fileLock.unlock(); }
+
+            Guard(const Guard&) = delete;
+            Guard& operator=(const Guard&) = delete;
+        };
+    };
+}
+
+#endif //PACMAN_RETRY_FILELOCK_H
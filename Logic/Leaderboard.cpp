@@ -0,0 +1,233 @@
+// Logic/Leaderboard.cpp
+#include "Leaderboard.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+namespace {
+    constexpr char SNAPSHOT_MAGIC[4] = {'P', 'M', 'L', 'B'};
+    constexpr char LOG_MAGIC[4] = {'P', 'M', 'L', 'G'};
+
+    using Logic::Leaderboard;
+
+    void putInt(char* out, const std::uint64_t value, const std::size_t bytes) {
+        for (std::size_t i = 0; i < bytes; ++i) out[i] = static_cast<char>(value >> (8 * i) & 0xFF);
+    }
+
+    std::uint64_t getInt(const char* in, const std::size_t bytes) {
+        std::uint64_t value = 0;
+        for (std::size_t i = 0; i < bytes; ++i) value |= static_cast<std::uint64_t>(static_cast<unsigned char>(in[i])) << (8 * i);
+        return value;
+    }
+
+    void encodeRecord(char* out, const std::string& name, const int score) {
+        putInt(out, static_cast<std::uint32_t>(score), 4);
+        std::memset(out + 4, 0, Leaderboard::NAME_LENGTH);
+        std::memcpy(out + 4, name.data(), std::min(name.size(), Leaderboard::NAME_LENGTH));
+    }
+
+    void decodeRecord(const char* in, std::string& name, int& score) {
+        score = static_cast<int>(static_cast<std::uint32_t>(getInt(in, 4)));
+        const char* text = in + 4;
+        name.assign(text, std::find(text, text + Leaderboard::NAME_LENGTH, '\0'));
+    }
+
+    /// Header of "<base>.idx" or "<base>.log"; false if the file is missing or not ours
+    bool readHeader(std::ifstream& file, const char (&magic)[4], std::uint32_t& generation, std::uint64_t& count) {
+        char header[Leaderboard::HEADER_SIZE];
+        if (!file.read(header, sizeof(header)) || std::memcmp(header, magic, 4) != 0) return false;
+        generation = static_cast<std::uint32_t>(getInt(header + 4, 4));
+        count = getInt(header + 8, 8);
+        return true;
+    }
+
+    void writeHeader(std::ostream& file, const char (&magic)[4], const std::uint32_t generation, const std::uint64_t count) {
+        char header[Leaderboard::HEADER_SIZE];
+        std::memcpy(header, magic, 4);
+        putInt(header + 4, generation, 4);
+        putInt(header + 8, count, 8);
+        file.write(header, sizeof(header));
+    }
+}
+
+namespace Logic {
+
+    Leaderboard::Leaderboard(const std::string& basePath)
+        : snapshotPath(basePath + ".idx"), logPath(basePath + ".log"), fileLock(basePath + ".lock") {
+        refresh();
+    }
+
+    std::string Leaderboard::normalizeName(const std::string& name) {
+        std::string normalized = name.substr(0, NAME_LENGTH);
+        normalized.erase(std::find(normalized.begin(), normalized.end(), '\0'), normalized.end());
+        return normalized;
+    }
+
+    int Leaderboard::bestOf(const std::string& name) const {
+        const auto it = best.find(normalizeName(name));
+        return it == best.end() ? -1 : it->second;
+    }
+
+    bool Leaderboard::apply(const std::string& name, const int score) {
+        const auto [it, inserted] = best.try_emplace(name, score);
+        if (!inserted) {
+            if (score <= it->second) return false;
+            index.erase(name, it->second);
+            it->second = score;
+        }
+        index.insert(name, score);
+        return true;
+    }
+
+    bool Leaderboard::catchUp() {
+        bool changed = false;
+
+        // Snapshot: reload everything when another instance compacted (or on first use)
+        std::uint32_t snapshotGeneration = 0;
+        std::uint64_t count = 0;
+        std::ifstream snapshot(snapshotPath, std::ios::binary);
+        const bool hasSnapshot = snapshot.is_open() && readHeader(snapshot, SNAPSHOT_MAGIC, snapshotGeneration, count);
+
+        if (!loaded || snapshotGeneration != generation) {
+            std::vector<RankedScore> sorted;
+            best.clear();
+            if (hasSnapshot) {
+                // The header's count is only trusted as far as the file can hold that many records
+                snapshot.seekg(0, std::ios::end);
+                const auto snapshotSize = static_cast<std::uint64_t>(snapshot.tellg());
+                if (snapshotSize < HEADER_SIZE || count > (snapshotSize - HEADER_SIZE) / RECORD_SIZE) {
+                    throw std::runtime_error("Leaderboard snapshot is truncated: " + snapshotPath);
+                }
+                snapshot.seekg(static_cast<std::streamoff>(HEADER_SIZE));
+
+                std::vector<char> records(count * RECORD_SIZE);
+                if (!snapshot.read(records.data(), static_cast<std::streamsize>(records.size()))) {
+                    throw std::runtime_error("Leaderboard snapshot is truncated: " + snapshotPath);
+                }
+                sorted.resize(count);
+                for (std::size_t i = 0; i < count; ++i) {
+                    decodeRecord(records.data() + i * RECORD_SIZE, sorted[i].name, sorted[i].score);
+                    best.emplace(sorted[i].name, sorted[i].score);
+                }
+            }
+            index.assignSorted(sorted);
+            generation = snapshotGeneration;
+            logOffset = HEADER_SIZE;
+            loaded = true;
+            changed = true;
+        }
+
+        // Log: apply the whole records we haven't seen yet
+        std::ifstream log(logPath, std::ios::binary);
+        std::uint32_t logGeneration = 0;
+        std::uint64_t unused = 0;
+        if (!log.is_open() || !readHeader(log, LOG_MAGIC, logGeneration, unused) || logGeneration != generation) {
+            return changed;
+        }
+
+        log.seekg(0, std::ios::end);
+        const auto logSize = static_cast<std::uint64_t>(log.tellg());
+        if (logSize <= logOffset) return changed;
+
+        const std::uint64_t available = (logSize - logOffset) / RECORD_SIZE * RECORD_SIZE;
+        std::vector<char> records(available);
+        log.seekg(static_cast<std::streamoff>(logOffset));
+        if (!log.read(records.data(), static_cast<std::streamsize>(available))) return changed;
+
+        std::string name;
+        int score;
+        for (std::uint64_t offset = 0; offset < available; offset += RECORD_SIZE) {
+            decodeRecord(records.data() + offset, name, score);
+            changed |= apply(name, score);
+        }
+        logOffset += available;
+        return changed;
+    }
+
+    bool Leaderboard::refresh() {
+        FileLock::Guard guard(fileLock, false);
+        return catchUp();
+    }
+
+    bool Leaderboard::submit(const std::string& name, const int score) {
+        const std::string key = normalizeName(name);
+
+        FileLock::Guard guard(fileLock, true);
+        catchUp();
+        if (!apply(key, score)) return false;
+
+        // Start a log for this generation, or cut a record a crashed writer left half-written
+        std::error_code error;
+        const std::uint64_t size = std::filesystem::exists(logPath, error) ? std::filesystem::file_size(logPath, error) : 0;
+        if (size < HEADER_SIZE || logOffset != size) {
+            std::ifstream existing(logPath, std::ios::binary);
+            std::uint32_t logGeneration = 0;
+            std::uint64_t unused = 0;
+            if (size < HEADER_SIZE || !readHeader(existing, LOG_MAGIC, logGeneration, unused) || logGeneration != generation) {
+                existing.close();
+                std::ofstream fresh(logPath, std::ios::binary | std::ios::trunc);
+                writeHeader(fresh, LOG_MAGIC, generation, 0);
+                logOffset = HEADER_SIZE;
+            } else {
+                existing.close();
+                std::filesystem::resize_file(logPath, logOffset, error);
+            }
+        }
+
+        char record[RECORD_SIZE];
+        encodeRecord(record, key, score);
+        {
+            std::ofstream log(logPath, std::ios::binary | std::ios::app);
+            log.write(record, sizeof(record));
+            log.close();
+            if (!log) {
+                std::cerr << "Failed to append to " << logPath << std::endl;
+                return true;
+            }
+        }
+        logOffset += RECORD_SIZE;
+
+        const std::uint64_t logRecords = (logOffset - HEADER_SIZE) / RECORD_SIZE;
+        if (logRecords >= std::max<std::uint64_t>(MIN_COMPACT_RECORDS, index.size() / 4)) compact();
+        return true;
+    }
+
+    void Leaderboard::compact() {
+        // Caller holds the exclusive lock and has caught up, so the index is the full truth
+        const std::uint32_t next = generation + 1;
+        const std::string temp = snapshotPath + ".tmp";
+        {
+            std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) return;
+            writeHeader(file, SNAPSHOT_MAGIC, next, index.size());
+
+            const std::vector<RankedScore> all = index.top(index.size());
+            std::vector<char> records(all.size() * RECORD_SIZE);
+            for (std::size_t i = 0; i < all.size(); ++i) encodeRecord(records.data() + i * RECORD_SIZE, all[i].name, all[i].score);
+            file.write(records.data(), static_cast<std::streamsize>(records.size()));
+            file.close();
+            if (!file) {
+                std::cerr << "Failed to write " << temp << std::endl;
+                return;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temp, snapshotPath, error);
+        if (error) {
+            std::cerr << "Failed to replace " << snapshotPath << ": " << error.message() << std::endl;
+            std::filesystem::remove(temp, error);
+            return;
+        }
+
+        // The old log is now part of the snapshot; a crash before this line leaves it with the old generation
+        std::ofstream log(logPath, std::ios::binary | std::ios::trunc);
+        writeHeader(log, LOG_MAGIC, next, 0);
+        generation = next;
+        logOffset = HEADER_SIZE;
+    }
+}
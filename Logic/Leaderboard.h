@@ -0,0 +1,132 @@
+// Logic/Leaderboard.h
+#ifndef PACMAN_RETRY_LEADERBOARD_H
+#define PACMAN_RETRY_LEADERBOARD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Logic/FileLock.h"
+#include "Logic/ScoreIndex.h"
+
+/**
+ * @file Leaderboard.h
+ * @brief Persistent best-score-per-player leaderboard shared by several game instances
+ *
+ * On disk a leaderboard is three files next to each other:
+ * - "<base>.idx": sorted snapshot, a 16-byte header (magic, generation,
+ *   count) followed by fixed-size records, highest score first
+ * - "<base>.log": append-only log of the submissions made since that
+ *   snapshot, a 16-byte header (magic, generation) followed by records
+ * - "<base>.lock": lock file; appends and compaction hold it exclusively,
+ *   reads hold it shared
+ *
+ * A record is a little-endian 32-bit score and a zero-padded name of at
+ * most NAME_LENGTH bytes. A log whose generation differs from the
+ * snapshot's was already folded into it (a compaction was interrupted)
+ * and is ignored.
+ *
+ * When the log grows past a fraction of the snapshot, the instance that
+ * appended last rewrites the snapshot (temp file + rename, bumping the
+ * generation) and starts an empty log. Other instances notice the new
+ * generation and reload; otherwise they only read the log records they
+ * have not seen yet.
+ */
+
+namespace Logic {
+
+    /**
+     * @class Leaderboard
+     * @brief In-memory index of every player's best score, kept in sync with the files
+     *
+     * Rank and top-k queries run on a ScoreIndex in O(log n) (+ k); nothing
+     * is read from disk for a query. refresh() catches up with submissions
+     * from other instances.
+     *
+     * Thread Safety:
+     * - NOT thread-safe - use one Leaderboard per thread; separate objects,
+     *   in this or other processes, synchronize through the lock file
+     */
+    class Leaderboard {
+    public:
+        static constexpr std::size_t NAME_LENGTH = 16;  ///< Longer names are cut
+        static constexpr std::size_t RECORD_SIZE = 4 + NAME_LENGTH;
+        static constexpr std::size_t HEADER_SIZE = 16;
+        static constexpr std::size_t MIN_COMPACT_RECORDS = 4096;  ///< Log size that may trigger compaction
+
+    private:
+        std::string snapshotPath;
+        std::string logPath;
+        FileLock fileLock;
+
+        ScoreIndex index;
+        std::unordered_map<std::string, int> best;  ///< Player name -> best score, mirrors index
+
+        std::uint32_t generation = 0;     ///< Snapshot generation the index was loaded from
+        bool loaded = false;
+        std::uint64_t logOffset = HEADER_SIZE;  ///< Log bytes already applied
+
+        /**
+         * @brief Brings the index up to date with the files; the lock must be held
+         * @return true if anything changed
+         */
+        bool catchUp();
+
+        /**
+         * @brief Applies one submission to the index
+         * @return true if it was a new best for that player
+         */
+        bool apply(const std::string& name, int score);
+
+        void compact();
+
+    public:
+        /**
+         * @param basePath Path of the files without extension (e.g. "../scores")
+         * @throws std::runtime_error if the lock file can't be opened
+         */
+        explicit Leaderboard(const std::string& basePath);
+
+        /**
+         * @brief Records a score, kept only if it beats the player's previous best
+         * @return true if it was a new best
+         *
+         * Appends one record to the log under the exclusive lock, after
+         * catching up with other instances; may trigger a compaction.
+         */
+        bool submit(const std::string& name, int score);
+
+        /**
+         * @brief Reads submissions made by other instances since the last call
+         * @return true if the leaderboard changed
+         * @throws std::runtime_error if the snapshot holds fewer records than its header claims
+         */
+        bool refresh();
+
+        /**
+         * @brief 1-based rank a score would have: one more than the number of players with a higher score
+         */
+        [[nodiscard]] std::size_t rankOf(int score) const { return index.countAbove(score) + 1; }
+
+        /**
+         * @brief The best count players, highest score first (ties by name)
+         */
+        [[nodiscard]] std::vector<RankedScore> top(std::size_t count) const { return index.top(count); }
+
+        /**
+         * @brief Best score of a player, or -1 if they have none
+         */
+        [[nodiscard]] int bestOf(const std::string& name) const;
+
+        [[nodiscard]] std::size_t size() const { return index.size(); }
+
+        /// Files that change when someone submits or compacts
+        [[nodiscard]] std::vector<std::string> files() const { return {snapshotPath, logPath}; }
+
+        /// Names are stored cut to NAME_LENGTH bytes; apply the same cut before comparing
+        static std::string normalizeName(const std::string& name);
+    };
+}
+
+#endif //PACMAN_RETRY_LEADERBOARD_H
@@ -0,0 +1,67 @@
+// Logic/LeaderboardWatcher.cpp
+#include "LeaderboardWatcher.h"
+
+#include <utility>
+
+namespace Logic {
+
+    LeaderboardWatcher::LeaderboardWatcher(const std::string& path, const int count, const std::chrono::milliseconds interval)
+        : manager(path), count(count), interval(interval) {
+        // Synchronous first load, so the menu has scores on its first frame
+        for (std::string& file : manager.files()) files.push_back({std::move(file)});
+        filesChanged();
+        publish();
+        thread = std::thread(&LeaderboardWatcher::run, this);
+    }
+
+    LeaderboardWatcher::~LeaderboardWatcher() {
+        {
+            std::lock_guard lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        thread.join();
+    }
+
+    std::vector<ScoreEntry> LeaderboardWatcher::getScores() const {
+        std::lock_guard lock(mutex);
+        return scores;
+    }
+
+    void LeaderboardWatcher::run() {
+        std::unique_lock lock(mutex);
+        while (!wake.wait_for(lock, interval, [this] { return stopping; })) {
+            // Stat and read without holding the lock, so readers never wait on the disk
+            lock.unlock();
+            if (filesChanged() && manager.refresh()) publish();
+            lock.lock();
+        }
+    }
+
+    bool LeaderboardWatcher::filesChanged() {
+        bool changed = false;
+        for (FileState& file : files) {
+            std::error_code error;
+            const bool exists = std::filesystem::is_regular_file(file.path, error);
+            const auto write = exists ? std::filesystem::last_write_time(file.path, error) : std::filesystem::file_time_type{};
+            const std::uintmax_t size = exists ? std::filesystem::file_size(file.path, error) : 0;
+            // A failed stat (file replaced in between) is retried on the next poll
+            if (error) continue;
+
+            changed |= exists != file.exists || write != file.lastWrite || size != file.size;
+            file.exists = exists;
+            file.lastWrite = write;
+            file.size = size;
+        }
+        return changed;
+    }
+
+    void LeaderboardWatcher::publish() {
+        std::vector<ScoreEntry> fresh = manager.getTopScores(count);
+        {
+            std::lock_guard lock(mutex);
+            scores = std::move(fresh);
+        }
+        version.fetch_add(1, std::memory_order_release);
+    }
+}
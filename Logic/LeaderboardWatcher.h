@@ -0,0 +1,95 @@
+// Logic/LeaderboardWatcher.h
+#ifndef PACMAN_RETRY_LEADERBOARDWATCHER_H
+#define PACMAN_RETRY_LEADERBOARDWATCHER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Logic/Score.h"
+
+namespace Logic {
+
+    /**
+     * @class LeaderboardWatcher
+     * @brief Keeps the top scores in memory and reloads them only when the leaderboard files change
+     *
+     * A background thread compares the modification time and size of the
+     * leaderboard's files every POLL_INTERVAL and refreshes its ScoreManager
+     * only when one of them changed (or a file appeared or disappeared); the
+     * refresh itself only reads the log records added since the last one.
+     * Readers check getVersion() once per frame, which is a single atomic
+     * load, and copy the scores only when it moved.
+     *
+     * Thread Safety:
+     * - getVersion() and getScores() may be called from any thread
+     */
+    class LeaderboardWatcher {
+    private:
+        struct FileState {
+            std::string path;
+            bool exists = false;
+            std::filesystem::file_time_type lastWrite{};
+            std::uintmax_t size = 0;
+        };
+
+        ScoreManager manager;  ///< Watcher thread only, once started
+        int count;
+        std::chrono::milliseconds interval;
+
+        mutable std::mutex mutex;
+        std::vector<ScoreEntry> scores;       ///< Guarded by mutex
+        bool stopping = false;                ///< Guarded by mutex
+        std::condition_variable wake;
+        std::atomic<std::uint64_t> version{0};
+        std::thread thread;
+
+        std::vector<FileState> files;  ///< Last seen state; watcher thread only, once started
+
+        void run();
+
+        /**
+         * @brief Stats the files and remembers what it saw
+         * @return true if any of them differs from the previous call
+         */
+        bool filesChanged();
+
+        /**
+         * @brief Publishes the manager's current top scores
+         */
+        void publish();
+
+    public:
+        static constexpr std::chrono::milliseconds POLL_INTERVAL{500};
+
+        /**
+         * @brief Loads the scores once, then starts watching the files
+         * @param path Leaderboard path without extension
+         * @param count Number of top scores to keep
+         * @param interval Time between two checks of the files
+         */
+        explicit LeaderboardWatcher(const std::string& path = ScoreManager::SCORE_FILE, int count = ScoreManager::MAX_SCORES,
+                                    std::chrono::milliseconds interval = POLL_INTERVAL);
+        ~LeaderboardWatcher();
+
+        LeaderboardWatcher(const LeaderboardWatcher&) = delete;
+        LeaderboardWatcher& operator=(const LeaderboardWatcher&) = delete;
+
+        /**
+         * @brief Increases every time the scores were reloaded after a change
+         */
+        [[nodiscard]] std::uint64_t getVersion() const { return version.load(std::memory_order_acquire); }
+
+        /**
+         * @brief Copy of the current top scores, highest first
+         */
+        [[nodiscard]] std::vector<ScoreEntry> getScores() const;
+    };
+}
+
+#endif //PACMAN_RETRY_LEADERBOARDWATCHER_H
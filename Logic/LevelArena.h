@@ -0,0 +1,80 @@
+// Logic/LevelArena.h
+#ifndef PACMAN_RETRY_LEVELARENA_H
+#define PACMAN_RETRY_LEVELARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+namespace Logic {
+
+    /**
+     * @class LevelArena
+     * @brief Bump allocator for the entities and views of one level
+     *
+     * Objects are created with make(), which puts the object and its
+     * shared_ptr control block in a single slice of a few large blocks
+     * instead of one heap allocation each. Individual frees are no-ops;
+     * every allocator handed out keeps the arena alive, so the blocks are
+     * returned in one go when the last object of the level (or the last
+     * weak_ptr to one) is gone, never while something still points into it.
+     *
+     * Thread Safety:
+     * - make() is NOT thread-safe - one arena per factory, filled by the thread building the level
+     * - Objects may be released from any thread (deallocation touches no arena state)
+     */
+    class LevelArena : public std::enable_shared_from_this<LevelArena> {
+    private:
+        std::pmr::monotonic_buffer_resource resource;
+
+    public:
+        /// First block; Map1 (objects plus control blocks) fits in it, bigger maps add a few doubling blocks
+        static constexpr std::size_t INITIAL_BLOCK = 64 * 1024;
+
+        explicit LevelArena(const std::size_t initialBlock = INITIAL_BLOCK) : resource(initialBlock) {}
+
+        LevelArena(const LevelArena&) = delete;
+        LevelArena& operator=(const LevelArena&) = delete;
+
+        /**
+         * @brief Allocator that carries a reference to its arena
+         */
+        template <typename T>
+        class Allocator {
+        private:
+            template <typename> friend class Allocator;
+            std::shared_ptr<LevelArena> arena;
+
+        public:
+            using value_type = T;
+
+            explicit Allocator(std::shared_ptr<LevelArena> arena) : arena(std::move(arena)) {}
+
+            template <typename U>
+            Allocator(const Allocator<U>& other) : arena(other.arena) {}
+
+            T* allocate(const std::size_t n) {
+                return static_cast<T*>(arena->resource.allocate(n * sizeof(T), alignof(T)));
+            }
+
+            void deallocate(T*, std::size_t) noexcept {
+                // Monotonic: memory comes back when the arena is destroyed
+            }
+
+            template <typename U>
+            bool operator==(const Allocator<U>& other) const { return arena == other.arena; }
+        };
+
+        /**
+         * @brief Constructs a T in the arena
+         * @note The arena itself must be owned by a shared_ptr
+         */
+        template <typename T, typename... Args>
+        std::shared_ptr<T> make(Args&&... args) {
+            return std::allocate_shared<T>(Allocator<T>(shared_from_this()), std::forward<Args>(args)...);
+        }
+    };
+}
+
+#endif //PACMAN_RETRY_LEVELARENA_H
@@ -0,0 +1,130 @@
+// Logic/Log.cpp
+#include "Log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+namespace {
+    constexpr std::string_view LEVEL_NAMES[] = {"debug", "info", "warning", "error", "off"};
+    constexpr std::string_view LEVEL_TAGS[] = {"DEBUG", "INFO ", "WARN ", "ERROR"};
+    constexpr std::string_view CATEGORY_NAMES[] = {"World", "Entity", "Score", "Render"};
+}
+
+namespace Logic {
+
+    std::atomic<LogLevel> Logger::threshold{LogLevel::Info};
+    std::atomic<std::uint32_t> Logger::categories{~0u};
+
+    Logger::Logger() : slots(std::make_unique<Slot[]>(CAPACITY)), start(std::chrono::steady_clock::now()) {
+        // Slot i is free for the producer that claims position i
+        for (std::size_t i = 0; i < CAPACITY; ++i) slots[i].sequence.store(i, std::memory_order_relaxed);
+        writer = std::thread(&Logger::writerLoop, this);
+    }
+
+    Logger::~Logger() {
+        stopping.store(true, std::memory_order_release);
+        writer.join();
+    }
+
+    Logger& Logger::getInstance() {
+        static Logger instance;
+        return instance;
+    }
+
+    bool Logger::push(const LogRecord& record) {
+        std::size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = slots[pos & (CAPACITY - 1)];
+            const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const auto lag = static_cast<std::ptrdiff_t>(sequence - pos);
+
+            if (lag == 0) {
+                // Free slot: claim the position, then fill it
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    LogRecord& target = slot.record;
+                    target.time = record.time;
+                    target.level = record.level;
+                    target.category = record.category;
+                    target.length = record.length;
+                    std::memcpy(target.text, record.text, record.length);
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (lag < 0) {
+                // The writer hasn't freed this slot yet: the ring is full
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool Logger::drain() {
+        std::string out;
+        // At most one lap per batch, so busy producers can't keep the writer from flushing
+        for (std::size_t count = 0; count < CAPACITY; ++count) {
+            Slot& slot = slots[dequeuePos & (CAPACITY - 1)];
+            if (slot.sequence.load(std::memory_order_acquire) != dequeuePos + 1) break;
+
+            const LogRecord& record = slot.record;
+            // The first record is stamped just before the logger starts
+            const double elapsed = std::max(0.0, std::chrono::duration<double>(record.time - start).count());
+            char stamp[32];
+            const auto [end, error] = std::to_chars(stamp, stamp + sizeof(stamp), elapsed, std::chars_format::fixed, 3);
+
+            out += '[';
+            if (error == std::errc()) out.append(stamp, end);
+            out += "] ";
+            out += LEVEL_TAGS[static_cast<std::size_t>(record.level)];
+            out += ' ';
+            out += CATEGORY_NAMES[static_cast<std::size_t>(record.category)];
+            out += ": ";
+            out.append(record.text, record.length);
+            out += '\n';
+
+            // Hand the slot back to the producers one lap later
+            slot.sequence.store(dequeuePos + CAPACITY, std::memory_order_release);
+            ++dequeuePos;
+        }
+
+        if (const std::size_t lost = dropped.exchange(0, std::memory_order_relaxed); lost > 0) {
+            out += "[log] " + std::to_string(lost) + " messages dropped, the log buffer was full\n";
+        }
+
+        if (out.empty()) return false;
+        std::clog.write(out.data(), static_cast<std::streamsize>(out.size()));
+        std::clog.flush();
+        return true;
+    }
+
+    void Logger::writerLoop() {
+        while (!stopping.load(std::memory_order_acquire)) {
+            // Keep going while there is a backlog, otherwise batch up for a while
+            if (!drain()) std::this_thread::sleep_for(DRAIN_INTERVAL);
+        }
+        drain();
+    }
+
+    void Logger::setCategoryEnabled(const LogCategory category, const bool enabled) {
+        const std::uint32_t bit = 1u << static_cast<unsigned>(category);
+        if (enabled) categories.fetch_or(bit, std::memory_order_relaxed);
+        else categories.fetch_and(~bit, std::memory_order_relaxed);
+    }
+
+    bool Logger::parseLevel(const std::string_view name, LogLevel& level) {
+        const auto it = std::ranges::find(LEVEL_NAMES, name);
+        if (it == std::end(LEVEL_NAMES)) return false;
+        level = static_cast<LogLevel>(it - std::begin(LEVEL_NAMES));
+        return true;
+    }
+
+    void LogLine::append(const std::string_view text) {
+        const std::size_t room = LogRecord::MAX_TEXT - record.length;
+        const std::size_t count = std::min(text.size(), room);
+        std::memcpy(record.text + record.length, text.data(), count);
+        record.length = static_cast<std::uint16_t>(record.length + count);
+    }
+}
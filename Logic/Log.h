@@ -0,0 +1,208 @@
+// Logic/Log.h
+#ifndef PACMAN_RETRY_LOG_H
+#define PACMAN_RETRY_LOG_H
+
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+
+/**
+ * @file Log.h
+ * @brief Asynchronous, leveled logging that never blocks the game tick
+ *
+ * Usage:
+ * @code
+ * LOG_DEBUG(Score) << "Coin collected! +" << points << " points";
+ * LOG_INFO(World) << "Level " << level << " ready!";
+ * @endcode
+ *
+ * A log statement formats into a fixed-size record on the caller's stack
+ * and copies it into a lock-free ring buffer; a background thread writes
+ * the buffer to std::clog in batches, so the calling thread never touches
+ * the console. When the ring is full the record is dropped and counted
+ * rather than waiting for the writer.
+ *
+ * Arguments are only evaluated when the level and category are enabled.
+ * With PACMAN_LOGGING set to 0 (the default when NDEBUG is defined, i.e.
+ * in release builds) the statements compile to nothing. Define
+ * PACMAN_LOGGING=1 to keep logging in a release build.
+ */
+
+#ifndef PACMAN_LOGGING
+#ifdef NDEBUG
+#define PACMAN_LOGGING 0
+#else
+#define PACMAN_LOGGING 1
+#endif
+#endif
+
+namespace Logic {
+
+    enum class LogLevel : std::uint8_t {
+        Debug,    ///< Per-event chatter (coins, respawns); off by default
+        Info,     ///< Game flow (levels, deaths, game over)
+        Warning,
+        Error,
+        Off       ///< Threshold only: disables every message
+    };
+
+    enum class LogCategory : std::uint8_t {
+        World,
+        Entity,
+        Score,
+        Render,
+        Count     ///< Number of categories, not a category
+    };
+
+    /**
+     * @struct LogRecord
+     * @brief One formatted message, as stored in the ring buffer
+     */
+    struct LogRecord {
+        static constexpr std::size_t MAX_TEXT = 232;  ///< Longer messages are truncated
+
+        std::chrono::steady_clock::time_point time;
+        LogLevel level = LogLevel::Info;
+        LogCategory category = LogCategory::World;
+        std::uint16_t length = 0;
+        char text[MAX_TEXT];
+    };
+
+    /**
+     * @class Logger
+     * @brief Process-wide ring buffer of log records and the thread that writes it out
+     *
+     * The ring is a bounded multi-producer queue (one sequence number per
+     * slot): any number of threads - the window thread, the simulation
+     * thread, every batch worker - push without locks, and only the writer
+     * thread pops. The thread is started on first use and joined, after
+     * writing whatever is left, when the program exits.
+     *
+     * Thread Safety:
+     * - push(), setLevel(), setCategoryEnabled() and enabled() may be called from any thread
+     */
+    class Logger {
+    private:
+        static constexpr std::size_t CAPACITY = 1024;  ///< Slots; power of two
+        static constexpr auto DRAIN_INTERVAL = std::chrono::milliseconds(10);
+
+        struct Slot {
+            std::atomic<std::size_t> sequence{0};
+            LogRecord record;
+        };
+
+        std::unique_ptr<Slot[]> slots;
+        alignas(64) std::atomic<std::size_t> enqueuePos{0};
+        alignas(64) std::size_t dequeuePos = 0;  ///< Writer thread only
+        std::atomic<std::size_t> dropped{0};
+        std::atomic<bool> stopping{false};
+        std::chrono::steady_clock::time_point start;
+        std::thread writer;
+
+        static std::atomic<LogLevel> threshold;
+        static std::atomic<std::uint32_t> categories;  ///< Bit per LogCategory
+
+        Logger();
+
+        void writerLoop();
+
+        /**
+         * @brief Writes every record published so far
+         * @return Whether anything was written
+         */
+        bool drain();
+
+    public:
+        ~Logger();
+
+        Logger(const Logger&) = delete;
+        Logger& operator=(const Logger&) = delete;
+
+        static Logger& getInstance();
+
+        /**
+         * @brief Queues a record for the writer thread
+         * @return false if the ring was full and the record was dropped
+         */
+        bool push(const LogRecord& record);
+
+        /// Messages below this level are skipped (default: Info)
+        static void setLevel(LogLevel level) { threshold.store(level, std::memory_order_relaxed); }
+        static LogLevel getLevel() { return threshold.load(std::memory_order_relaxed); }
+
+        static void setCategoryEnabled(LogCategory category, bool enabled);
+
+        /**
+         * @brief Parses "debug", "info", "warning", "error" or "off"
+         * @return false if the name is unknown (level is left untouched)
+         */
+        static bool parseLevel(std::string_view name, LogLevel& level);
+
+        static bool enabled(const LogLevel level, const LogCategory category) {
+            return level >= threshold.load(std::memory_order_relaxed) &&
+                   (categories.load(std::memory_order_relaxed) & (1u << static_cast<unsigned>(category))) != 0;
+        }
+    };
+
+    /**
+     * @class LogLine
+     * @brief Builds one record with operator<< and queues it when destroyed
+     *
+     * Formats without allocating (std::to_chars into the record's buffer).
+     * Use it through the LOG_* macros rather than directly.
+     */
+    class LogLine {
+    private:
+        LogRecord record;
+
+        void append(std::string_view text);
+
+    public:
+        LogLine(const LogLevel level, const LogCategory category) {
+            record.time = std::chrono::steady_clock::now();
+            record.level = level;
+            record.category = category;
+        }
+        ~LogLine() { Logger::getInstance().push(record); }
+
+        LogLine(const LogLine&) = delete;
+        LogLine& operator=(const LogLine&) = delete;
+
+        LogLine& operator<<(const std::string_view text) { append(text); return *this; }
+        LogLine& operator<<(const char* text) { append(text); return *this; }
+        LogLine& operator<<(const char ch) { append(std::string_view(&ch, 1)); return *this; }
+        LogLine& operator<<(const bool value) { append(value ? "true" : "false"); return *this; }
+
+        template <typename T> requires (std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>)
+        LogLine& operator<<(const T value) {
+            char buffer[32];
+            const auto [end, error] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            if (error == std::errc()) append(std::string_view(buffer, end - buffer));
+            return *this;
+        }
+    };
+}
+
+#if PACMAN_LOGGING
+#define PACMAN_LOG(level, category) \
+    if (!::Logic::Logger::enabled(level, ::Logic::LogCategory::category)) {} \
+    else ::Logic::LogLine(level, ::Logic::LogCategory::category)
+#else
+// Still type-checked, never compiled into the binary
+#define PACMAN_LOG(level, category) \
+    if constexpr (true) {} \
+    else ::Logic::LogLine(level, ::Logic::LogCategory::category)
+#endif
+
+#define LOG_DEBUG(category) PACMAN_LOG(::Logic::LogLevel::Debug, category)
+#define LOG_INFO(category) PACMAN_LOG(::Logic::LogLevel::Info, category)
+#define LOG_WARNING(category) PACMAN_LOG(::Logic::LogLevel::Warning, category)
+#define LOG_ERROR(category) PACMAN_LOG(::Logic::LogLevel::Error, category)
+
+#endif //PACMAN_RETRY_LOG_H
@@ -0,0 +1,171 @@
+// Logic/MapLoader.cpp
+#include "MapLoader.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+    constexpr std::uint64_t FNV_OFFSET = 14695981039346656037ULL;
+    constexpr std::uint64_t FNV_PRIME = 1099511628211ULL;
+
+    // FNV-1a over the map text, one line at a time
+    std::uint64_t hashLine(std::uint64_t hash, const std::string& line) {
+        for (const char ch : line) {
+            hash ^= static_cast<unsigned char>(ch);
+            hash *= FNV_PRIME;
+        }
+        hash ^= static_cast<unsigned char>('\n');
+        hash *= FNV_PRIME;
+        return hash;
+    }
+
+    std::uint64_t hashValue(std::uint64_t hash, std::uint64_t value) {
+        for (int i = 0; i < 8; ++i) {
+            hash ^= value & 0xFF;
+            hash *= FNV_PRIME;
+            value >>= 8;
+        }
+        return hash;
+    }
+
+    bool isMapTile(const char ch) {
+        switch (ch) {
+            case '#': case '0': case 'f': case ' ': case 'P':
+            case 'R': case 'I': case 'B': case 'O':
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    std::runtime_error mapError(const std::string& name, const int line, const std::string& message) {
+        return std::runtime_error(name + ":" + std::to_string(line) + ": " + message);
+    }
+}
+
+namespace Logic {
+
+    std::shared_ptr<const LevelDescription> MapLoader::load(const std::string& path) {
+        if (const auto it = cache.find(path); it != cache.end()) return it->second;
+
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to open map file: " + path);
+        }
+
+        auto level = std::make_shared<const LevelDescription>(parse(file, path));
+        cache.emplace(path, level);
+        return level;
+    }
+
+    LevelDescription MapLoader::parse(std::istream& input, const std::string& name) {
+        LevelDescription level;
+        level.name = name;
+        level.hash = FNV_OFFSET;
+
+        std::vector<std::string> rows;
+        std::string line;
+        while (std::getline(input, line)) {
+            level.hash = hashLine(level.hash, line);
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            rows.push_back(std::move(line));
+        }
+
+        // Trailing blank lines are not rows
+        while (!rows.empty() && rows.back().empty()) rows.pop_back();
+        if (rows.empty() || rows.front().empty()) {
+            throw mapError(name, 1, "map is empty");
+        }
+
+        level.width = static_cast<int>(rows.front().size());
+        level.height = static_cast<int>(rows.size());
+        level.tiles.resize(static_cast<std::size_t>(level.width) * level.height);
+
+        int pacmanCount = 0;
+        for (int y = 0; y < level.height; ++y) {
+            const std::string& row = rows[y];
+            if (static_cast<int>(row.size()) != level.width) {
+                throw mapError(name, y + 1, "row is " + std::to_string(row.size()) + " tiles wide, the first row is " +
+                                            std::to_string(level.width));
+            }
+
+            for (int x = 0; x < static_cast<int>(row.size()); ++x) {
+                const char ch = row[x];
+                if (!isMapTile(ch)) {
+                    throw mapError(name, y + 1, std::string("unknown tile '") + ch + "' in column " + std::to_string(x + 1));
+                }
+                if (ch == 'P' && ++pacmanCount > 1) {
+                    throw mapError(name, y + 1, "second Pacman spawn in column " + std::to_string(x + 1));
+                }
+                level.tiles[static_cast<std::size_t>(y) * level.width + x] = ch;
+            }
+        }
+
+        if (pacmanCount == 0) {
+            throw mapError(name, level.height, "map has no Pacman spawn ('P')");
+        }
+        return level;
+    }
+
+    LevelSet LevelSet::load(const std::string& path, MapLoader& loader) {
+        namespace fs = std::filesystem;
+
+        LevelSet set;
+        set.name = path;
+
+        std::vector<std::string> mapPaths;
+        if (fs::is_directory(path)) {
+            // Every visible map file in the directory, in name order
+            for (const auto& entry : fs::directory_iterator(path)) {
+                const std::string fileName = entry.path().filename().string();
+                if (!entry.is_regular_file() || fileName.starts_with('.') || entry.path().extension() == ".levels") continue;
+                mapPaths.push_back(entry.path().string());
+            }
+            std::ranges::sort(mapPaths);
+        } else if (fs::path(path).extension() == ".levels") {
+            std::ifstream manifest(path);
+            if (!manifest.is_open()) {
+                throw std::runtime_error("Failed to open level manifest: " + path);
+            }
+
+            // One map per line, relative to the manifest; blank lines and "//" comments are skipped
+            const fs::path directory = fs::path(path).parent_path();
+            std::string line;
+            while (std::getline(manifest, line)) {
+                if (!line.empty() && line.back() == '\r') line.pop_back();
+                if (line.empty() || line.starts_with("//")) continue;
+                mapPaths.push_back((directory / line).string());
+            }
+        } else {
+            mapPaths.push_back(path);
+        }
+
+        if (mapPaths.empty()) {
+            throw std::runtime_error("No maps found in " + path);
+        }
+
+        for (const std::string& mapPath : mapPaths) {
+            set.levels.push_back(loader.load(mapPath));
+        }
+
+        if (set.levels.size() == 1) {
+            set.hash = set.levels.front()->hash;
+        } else {
+            set.hash = FNV_OFFSET;
+            for (const auto& level : set.levels) set.hash = hashValue(set.hash, level->hash);
+        }
+        return set;
+    }
+
+    LevelSet LevelSet::load(const std::string& path) {
+        MapLoader loader;
+        return load(path, loader);
+    }
+
+    const LevelDescription& LevelSet::forLevel(const int level) const {
+        const std::size_t index = static_cast<std::size_t>(std::max(level - 1, 0)) % levels.size();
+        return *levels[index];
+    }
+}
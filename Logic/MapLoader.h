@@ -0,0 +1,117 @@
+// Logic/MapLoader.h
+#ifndef PACMAN_RETRY_MAPLOADER_H
+#define PACMAN_RETRY_MAPLOADER_H
+
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file MapLoader.h
+ * @brief Reads and validates map files once, into reusable level descriptions
+ *
+ * Map format: one text line per tile row.
+ * - '#' wall, '0' coin, 'f' fruit, ' ' empty
+ * - 'P' Pacman spawn (exactly one)
+ * - 'R', 'I', 'B', 'O' ghost spawns
+ *
+ * The first row sets the map width and every other row must match it, so
+ * empty tiles at the end of a row are written out as spaces. Ragged rows
+ * (shorter or longer), unknown characters and a missing or duplicate Pacman
+ * are rejected with the file name and line number.
+ *
+ * A level set is either a single map, a directory of maps (played in file
+ * name order) or a manifest file with the ".levels" extension listing one
+ * map path per line, relative to the manifest. Every map of a set is read
+ * when the set is loaded, so level transitions never touch the filesystem.
+ */
+
+namespace Logic {
+
+    /**
+     * @struct LevelDescription
+     * @brief Parsed, validated tile layout of one map
+     */
+    struct LevelDescription {
+        std::string name;          ///< Path the map was read from
+        int width = 0;
+        int height = 0;
+        std::vector<char> tiles;   ///< Row-major, width * height
+        std::uint64_t hash = 0;    ///< FNV-1a over the file's lines, identifies the map in replays
+
+        [[nodiscard]] char at(const int x, const int y) const { return tiles[static_cast<std::size_t>(y) * width + x]; }
+    };
+
+    /**
+     * @class MapLoader
+     * @brief Parses map files, caching each by path so it is read at most once
+     *
+     * Not thread-safe; load level sets up front and share the resulting
+     * (immutable) LevelSet between Worlds instead.
+     */
+    class MapLoader {
+    private:
+        std::unordered_map<std::string, std::shared_ptr<const LevelDescription>> cache;
+
+    public:
+        /**
+         * @brief Returns the map at path, reading it on first use
+         * @throws std::runtime_error if the file can't be read or is not a valid map
+         */
+        std::shared_ptr<const LevelDescription> load(const std::string& path);
+
+        /**
+         * @brief Parses and validates a map from a stream
+         * @param input Map text
+         * @param name Used in error messages and as LevelDescription::name
+         * @throws std::runtime_error if the map is invalid
+         */
+        static LevelDescription parse(std::istream& input, const std::string& name);
+    };
+
+    /**
+     * @class LevelSet
+     * @brief Maps played on successive levels, all loaded in memory
+     *
+     * Level n plays map (n - 1) modulo the number of maps, so a single map
+     * repeats forever like the original game.
+     */
+    class LevelSet {
+    private:
+        std::string name;
+        std::uint64_t hash = 0;
+        std::vector<std::shared_ptr<const LevelDescription>> levels;
+
+    public:
+        /**
+         * @brief Loads a single map, a directory of maps or a ".levels" manifest
+         * @param path What to load
+         * @param loader Cache to read the maps through
+         * @throws std::runtime_error if nothing valid could be loaded
+         */
+        static LevelSet load(const std::string& path, MapLoader& loader);
+
+        /**
+         * @brief Same as above with a loader of its own
+         */
+        static LevelSet load(const std::string& path);
+
+        /**
+         * @brief Map for a level number (1-based)
+         */
+        [[nodiscard]] const LevelDescription& forLevel(int level) const;
+
+        [[nodiscard]] std::size_t size() const { return levels.size(); }
+
+        /// Path the set was loaded from
+        [[nodiscard]] const std::string& getName() const { return name; }
+
+        /// Equals the map's own hash for a single map, so replays of one map keep matching
+        [[nodiscard]] std::uint64_t getHash() const { return hash; }
+    };
+}
+
+#endif //PACMAN_RETRY_MAPLOADER_H
@@ -6,23 +6,39 @@
 
 #include <algorithm>
 
-void Subject::attach(const std::shared_ptr<Observer>& observer) {
+void Subject::attach(const std::shared_ptr<Observer>& observer, const EventMask events) {
     // Check if observer is already attached to avoid duplicates
-    if (auto it = std::ranges::find(observers, observer); it == observers.end()) {
-        observers.push_back(observer);
+    if (auto it = std::ranges::find(subscriptions, observer, &Subscription::observer); it == subscriptions.end()) {
+        subscriptions.push_back({observer, events});
+    } else {
+        it->events |= events;
     }
+    subscribed |= events;
 }
 
 void Subject::detach(const std::shared_ptr<Observer>& observer) {
     // Remove the observer from the vector
-    std::erase(observers, observer);
+    std::erase_if(subscriptions, [&](const Subscription& subscription) { return subscription.observer == observer; });
+
+    subscribed = 0;
+    for (const auto& subscription : subscriptions) {
+        subscribed |= subscription.events;
+    }
 }
 
-void Subject::notify() const {
-    // Notify all attached observers
-    for (auto& observer : observers) {
-        if (observer) {
-            observer->onNotify();
+void Subject::dispatch(const EventType event) const {
+    // Notify the observers that subscribed to this event
+    const EventMask bit = eventBit(event);
+    for (const auto& subscription : subscriptions) {
+        if ((subscription.events & bit) != 0 && subscription.observer) {
+            subscription.observer->onNotify(event);
         }
     }
 }
+
+void Subject::notify(EventMask events) const {
+    events &= subscribed;
+    for (unsigned type = 0; events != 0; ++type, events >>= 1) {
+        if ((events & 1) != 0) dispatch(static_cast<EventType>(type));
+    }
+}
@@ -4,6 +4,7 @@
 
 #ifndef PACMAN_RETRY_OBSERVER_H
 #define PACMAN_RETRY_OBSERVER_H
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -18,29 +19,37 @@
  * Pattern Structure:
  * - Subject (Model): Entities that can be observed
  * - Observer (View): Objects that watch Subjects and react to changes
- * - Notification Flow: Subject::notify() → Observer::onNotify()
+ * - Notification Flow: Subject::notify(EventType) → Observer::onNotify(EventType)
+ *
+ * Notifications are typed. An observer subscribes to the event types it
+ * cares about, and a subject only publishes an event when the state behind
+ * it actually changed. A subject keeps the union of its subscriptions, so
+ * publishing an event nobody listens to (or notifying a coin, which has no
+ * observers at all) is a single bit test.
+ *
+ * Views do not draw from notifications: they read the frame snapshot in
+ * the Renderer pass and subscribe only to AnimationUpdate, which the level
+ * sends once per rendered frame. The other event types are published by
+ * the entities but currently have no subscribers; they are there for
+ * future observers (sound, statistics) and cost one bit test until then.
  *
  * Usage Example:
  * @code
  * // Model side (Logic layer)
- * class Pacman : public Subject {
- *     void move() {
- *         x += speed;
- *         notify(); // Trigger view updates
- *     }
- * };
+ * void World::notifyViews() const {
+ *     pacman->notify(EventType::AnimationUpdate); // Once per rendered frame
+ * }
  *
  * // View side (Representation layer)
  * class PacmanView : public Observer {
- *     void onNotify() override {
- *         draw(); // Redraw Pacman at new position
+ *     void onNotify(EventType event) override {
+ *         if (event == EventType::AnimationUpdate) updateAnimation();
  *     }
  * };
  *
  * // Connection (in ConcreteFactory)
- * auto pacman = std::make_shared<Pacman>();
- * auto view = std::make_shared<PacmanView>(pacman);
- * pacman->attach(view); // View now observes Pacman
+ * auto view = arena->make<PacmanView>(pacman, frame.entities, camera, window);
+ * pacman->attach(view, eventBit(EventType::AnimationUpdate)); // Nothing else reaches the view
  * @endcode
  */
 
@@ -48,26 +57,38 @@
  * @enum EventType
  * @brief Types of events that can trigger observer notifications
  *
- * While these event types are defined, the current implementation uses
- * a simpler approach where observers are notified generically and determine
- * what to do based on the subject's current state.
- *
- * Future Enhancement: Could be used for more granular event handling where
- * observers only react to specific event types rather than all notifications.
- *
- * @note Currently unused in favor of simpler generic notification
+ * Each value is one bit in an EventMask, so an observer can subscribe to
+ * any combination of them. Only AnimationUpdate has subscribers (the
+ * entity views); the rest are published for future observers.
  */
-enum class EventType {
-    EntityMoved,        ///< Entity changed position
-    EntityDied,         ///< Entity entered death state
-    CoinCollected,      ///< Coin was picked up
-    FruitCollected,     ///< Fruit was picked up
-    GhostEaten,         ///< Ghost was eaten by Pacman
-    DirectionChanged,   ///< Entity changed movement direction
-    ModeChanged,        ///< Ghost changed AI mode (chasing/feared)
-    AnimationUpdate     ///< Generic signal to update animation frame
+enum class EventType : std::uint8_t {
+    EntityMoved,        ///< Entity changed position (no subscribers yet)
+    EntityDied,         ///< Entity entered death state (no subscribers yet)
+    CoinCollected,      ///< Coin was picked up (no subscribers yet; Score is called directly)
+    FruitCollected,     ///< Fruit was picked up (no subscribers yet; Score is called directly)
+    GhostEaten,         ///< Ghost was eaten by Pacman (no subscribers yet; Score is called directly)
+    DirectionChanged,   ///< Entity changed movement direction (no subscribers yet)
+    ModeChanged,        ///< Ghost changed AI mode (chasing/feared) (no subscribers yet)
+    AnimationUpdate     ///< Once per rendered frame: views advance their animation
 };
 
+/**
+ * @brief Set of event types, one bit per EventType
+ */
+using EventMask = std::uint32_t;
+
+/**
+ * @brief Bit of one event type in an EventMask
+ */
+constexpr EventMask eventBit(EventType type) {
+    return EventMask{1} << static_cast<unsigned>(type);
+}
+
+/**
+ * @brief Mask that subscribes to every event type
+ */
+constexpr EventMask ALL_EVENTS = ~EventMask{0};
+
 /**
  * @class Observer
  * @brief Abstract base class for objects that observe Subjects
@@ -105,20 +126,23 @@ public:
     virtual ~Observer() = default;
 
     /**
-     * @brief Called when the observed Subject's state changes
+     * @brief Called when the observed Subject publishes a subscribed event
+     * @param event What changed
      *
      * This pure virtual method must be implemented by all concrete observers.
      * It defines how the observer responds to changes in the subject.
      *
      * Implementation Strategy:
-     * - EntityView subclasses typically call draw() to re-render
-     * - Score class performs point calculations based on event type
-     * - Could check subject's state to determine specific response
+     * - EntityView subclasses pick their next sprite frame on AnimationUpdate;
+     *   the Renderer draws them later from the frame snapshot, and they notice
+     *   deaths and mode changes by comparing snapshot values, not from events
+     * - Coins and fruits have no views to notify: the PickupBatch hides a
+     *   quad when the snapshot flags its pickup as collected
      *
-     * @note This method is called by Subject::notify()
-     * @note May be called multiple times per frame if subject changes frequently
+     * @note This method is called by Subject::notify(), only for event types
+     *       the observer was attached with
      */
-    virtual void onNotify() = 0;
+    virtual void onNotify(EventType event) = 0;
 };
 
 /**
@@ -130,10 +154,9 @@ public:
  * changes, it calls notify() to inform all attached observers.
  *
  * Design Principles:
- * - Manages a list of weak_ptr to observers (not owning)
- * - Automatically removes destroyed observers
- * - Prevents duplicate observer registration
- * - Safe to attach/detach during notification (uses weak_ptr)
+ * - Each observer is stored with the mask of event types it subscribed to
+ * - Prevents duplicate observer registration (re-attaching widens the mask)
+ * - Keeps the union of all masks so unobserved events cost one bit test
  *
  * Memory Management:
  * - Uses std::shared_ptr for observer storage in the vector
@@ -147,10 +170,9 @@ public:
  * @code
  * class MyEntity : public Subject {
  *     void changeState() {
- *         // Modify internal state
+ *         if (x == newX) return; // Nothing changed, nothing to publish
  *         x = newX;
- *         // Notify all observers
- *         notify();
+ *         notify(EventType::EntityMoved);
  *     }
  * };
  * @endcode
@@ -162,7 +184,21 @@ public:
  * @see Observer For the observer side of the pattern
  */
 class Subject {
-    std::vector<std::shared_ptr<Observer>> observers;  ///< List of attached observers
+    /**
+     * @brief One attached observer and the events it wants
+     */
+    struct Subscription {
+        std::shared_ptr<Observer> observer;
+        EventMask events;
+    };
+
+    std::vector<Subscription> subscriptions;  ///< List of attached observers
+    EventMask subscribed = 0;                 ///< Union of all subscription masks
+
+    /**
+     * @brief Calls onNotify on every observer subscribed to the event
+     */
+    void dispatch(EventType event) const;
 
 public:
     /**
@@ -175,9 +211,11 @@ public:
     /**
      * @brief Attaches an observer to receive notifications
      * @param observer Shared pointer to the observer to attach
+     * @param events Event types to deliver (default: all of them)
      *
      * The observer will be added to the notification list if it's not already present.
-     * Duplicate observers are automatically prevented using std::ranges::find.
+     * Attaching an observer that is already present adds the new event types
+     * to its existing subscription instead of duplicating it.
      *
      * Memory Management:
      * - Takes a shared_ptr, so the Subject shares ownership with the caller
@@ -194,10 +232,10 @@ public:
      * @code
      * auto entity = std::make_shared<Pacman>();
      * auto view = std::make_shared<PacmanView>();
-     * entity->attach(view); // View will be notified of entity changes
+     * entity->attach(view, eventBit(EventType::EntityDied)); // View hears only deaths
      * @endcode
      */
-    void attach(const std::shared_ptr<Observer>& observer);
+    void attach(const std::shared_ptr<Observer>& observer, EventMask events = ALL_EVENTS);
 
     /**
      * @brief Detaches an observer from the notification list
@@ -206,17 +244,18 @@ public:
      * Removes the specified observer from the list. If the observer is not
      * in the list, this is a no-op (safe to call even if not attached).
      *
-     * Uses std::erase which automatically handles:
+     * Uses std::erase_if which automatically handles:
      * - Removing all matching elements (though there should only be one)
      * - Shrinking the vector
      * - Calling the observer's destructor if this was the last reference
      *
+     * The union of the remaining subscriptions is recomputed afterwards.
+     *
      * Performance:
      * - O(n) search + O(n) removal (where n = number of observers)
      * - Acceptable since n is typically very small (1-2)
      *
      * @note Thread-unsafe - do not call from multiple threads
-     * @note Safe to call during notify() loop (uses std::erase, not manual iteration)
      *
      * Example:
      * @code
@@ -226,26 +265,26 @@ public:
     void detach(const std::shared_ptr<Observer>& observer);
 
     /**
-     * @brief Notifies all attached observers of a state change
+     * @brief Publishes an event to the observers subscribed to it
+     * @param event What changed
      *
-     * Iterates through all observers and calls their onNotify() method.
-     * Automatically skips null observers (defensive programming).
+     * Calls onNotify(event) on every observer whose subscription includes
+     * the event type. Automatically skips null observers (defensive programming).
      *
-     * Call this method whenever the Subject's state changes in a way that
-     * observers need to know about. For example:
-     * - Entity moved to new position
-     * - Ghost changed state (chasing → feared)
-     * - Animation frame needs to update
+     * Call this method when the Subject's state actually changes in a way
+     * observers may need to know about. For example:
+     * - Entity moved to new position (EntityMoved)
+     * - Ghost changed state, chasing → feared (ModeChanged)
+     * - Coin was picked up (CoinCollected)
      *
      * Performance:
-     * - O(n) where n = number of observers
-     * - Each observer's onNotify() may trigger rendering or other work
-     * - Called frequently (potentially every frame), so keep observer count low
+     * - One bit test when no observer subscribed to the event (inlined)
+     * - Otherwise O(n) where n = number of observers
+     * - Static entities without observers therefore cost nothing per frame
      *
      * Safety:
      * - Null-checks observers before calling (defensive)
-     * - Uses range-based for loop which is safe with std::erase during iteration
-     * - Observers can safely detach themselves during notification
+     * - Observers must not attach or detach during notification
      *
      * @note Thread-unsafe - assumes single-threaded game loop
      * @note Marked const because it doesn't modify Subject's logical state
@@ -253,15 +292,27 @@ public:
      *
      * Example:
      * @code
-     * class Pacman : public Subject {
-     *     void update(float deltaTime) {
-     *         x += speed * deltaTime;
-     *         notify(); // Tell views to redraw at new position
+     * class Ghost : public Subject {
+     *     void setState(GhostState newState) {
+     *         if (state == newState) return;
+     *         state = newState;
+     *         notify(EventType::ModeChanged);
      *     }
      * };
      * @endcode
      */
-    void notify() const;
+    void notify(const EventType event) const {
+        if ((subscribed & eventBit(event)) != 0) dispatch(event);
+    }
+
+    /**
+     * @brief Publishes every event in a mask, in EventType order
+     * @param events Events whose state changed, e.g. collected by a pass over EntityStore rows
+     *
+     * Same as calling notify() for each event in the mask; costs one bit
+     * test when nobody subscribed to any of them.
+     */
+    void notify(EventMask events) const;
 };
 
 #endif //PACMAN_RETRY_OBSERVER_H
\ No newline at end of file
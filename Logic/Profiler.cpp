@@ -0,0 +1,171 @@
+// Logic/Profiler.cpp
+#include "Profiler.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+
+namespace Logic {
+
+    std::atomic<bool> Profiler::enabled{false};
+    std::atomic<bool> Profiler::tracing{false};
+
+    Profiler::Profiler() {
+        for (Histogram& histogram : histograms) {
+            for (auto& slot : histogram.ring) slot.store(EMPTY, std::memory_order_relaxed);
+            for (auto& count : histogram.counts) count.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    Profiler& Profiler::getInstance() {
+        static Profiler instance;
+        return instance;
+    }
+
+    const char* Profiler::phaseName(const ProfilePhase phase) {
+        switch (phase) {
+            case ProfilePhase::Frame: return "Frame";
+            case ProfilePhase::Input: return "Input";
+            case ProfilePhase::Tick: return "Tick";
+            case ProfilePhase::Pacman: return "Pacman";
+            case ProfilePhase::Ghosts: return "Ghosts";
+            case ProfilePhase::Pickups: return "Pickups";
+            case ProfilePhase::Notify: return "Notify";
+            case ProfilePhase::Hud: return "Hud";
+            case ProfilePhase::Render: return "Render";
+            case ProfilePhase::Display: return "Display";
+            case ProfilePhase::Count: break;
+        }
+        return "?";
+    }
+
+    std::uint8_t Profiler::bucketOf(const std::uint64_t nanoseconds) {
+        // 0-7 ns get a bucket each, then 8 buckets per power of two
+        if (nanoseconds < 8) return static_cast<std::uint8_t>(nanoseconds);
+        const int exponent = std::bit_width(nanoseconds) - 1;
+        const std::uint64_t bucket = static_cast<std::uint64_t>(exponent - 2) * 8 + (nanoseconds >> (exponent - 3) & 7);
+        return static_cast<std::uint8_t>(std::min<std::uint64_t>(bucket, BUCKETS - 1));
+    }
+
+    double Profiler::bucketStart(const std::size_t bucket) {
+        if (bucket < 8) return static_cast<double>(bucket);
+        const int exponent = static_cast<int>(bucket / 8) + 2;
+        return std::ldexp(static_cast<double>(8 + bucket % 8), exponent - 3);
+    }
+
+    std::uint32_t Profiler::threadIndex() {
+        static std::atomic<std::uint32_t> threads{0};
+        thread_local const std::uint32_t index = threads.fetch_add(1, std::memory_order_relaxed) + 1;
+        return index;
+    }
+
+    void Profiler::record(const ProfilePhase phase, const Clock::time_point start, const Clock::time_point end) {
+        const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+        // Replace the oldest sample of the window
+        Histogram& histogram = histograms[static_cast<std::size_t>(phase)];
+        const std::uint8_t bucket = bucketOf(static_cast<std::uint64_t>(std::max<std::int64_t>(nanoseconds, 0)));
+        const std::size_t slot = histogram.next.fetch_add(1, std::memory_order_relaxed) % WINDOW;
+        const std::uint8_t evicted = histogram.ring[slot].exchange(bucket, std::memory_order_relaxed);
+        if (evicted != EMPTY) histogram.counts[evicted].fetch_sub(1, std::memory_order_relaxed);
+        histogram.counts[bucket].fetch_add(1, std::memory_order_relaxed);
+
+        // Acquire: the buffer and start time are set before tracing is switched on
+        if (!tracing.load(std::memory_order_acquire)) return;
+        const std::size_t index = traceCount.fetch_add(1, std::memory_order_relaxed);
+        if (index >= TRACE_CAPACITY) return;
+
+        TraceEvent& event = trace[index];
+        event.start = std::chrono::duration_cast<std::chrono::nanoseconds>(start - traceStart).count();
+        event.duration = nanoseconds;
+        event.thread = threadIndex();
+        event.phase = phase;
+        event.session.store(traceSession.load(std::memory_order_relaxed), std::memory_order_release);
+    }
+
+    PhaseStats Profiler::stats(const ProfilePhase phase) const {
+        const Histogram& histogram = histograms[static_cast<std::size_t>(phase)];
+
+        // Counts may move while we read them; the window is approximate anyway
+        std::array<std::uint32_t, BUCKETS> counts{};
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < BUCKETS; ++i) {
+            counts[i] = histogram.counts[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+
+        PhaseStats result;
+        result.samples = total;
+        if (total == 0) return result;
+
+        const auto percentile = [&](const double fraction) {
+            const auto rank = static_cast<std::size_t>(std::ceil(fraction * static_cast<double>(total)));
+            std::size_t seen = 0;
+            for (std::size_t i = 0; i < BUCKETS; ++i) {
+                seen += counts[i];
+                // Middle of the bucket, in microseconds
+                if (seen >= rank) return (bucketStart(i) + bucketStart(i + 1)) / 2000.0;
+            }
+            return bucketStart(BUCKETS - 1) / 1000.0;
+        };
+        result.p50 = percentile(0.50);
+        result.p99 = percentile(0.99);
+        return result;
+    }
+
+    void Profiler::reset() {
+        for (Histogram& histogram : histograms) {
+            for (auto& slot : histogram.ring) {
+                const std::uint8_t evicted = slot.exchange(EMPTY, std::memory_order_relaxed);
+                if (evicted != EMPTY) histogram.counts[evicted].fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void Profiler::startTrace() {
+        std::lock_guard lock(traceMutex);
+        if (!trace) trace = std::make_unique<TraceEvent[]>(TRACE_CAPACITY);
+
+        traceStart = Clock::now();
+        traceSession.fetch_add(1, std::memory_order_relaxed);
+        traceCount.store(0, std::memory_order_relaxed);
+        tracing.store(true, std::memory_order_release);
+    }
+
+    std::size_t Profiler::stopTrace(const std::string& path) {
+        std::lock_guard lock(traceMutex);
+        tracing.store(false, std::memory_order_relaxed);
+        if (!trace) return 0;
+
+        std::ofstream file(path, std::ios::trunc);
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to open trace file for writing: " + path);
+        }
+
+        // Complete events ("ph":"X"), timestamps in microseconds
+        const std::size_t claimed = std::min(traceCount.load(std::memory_order_relaxed), TRACE_CAPACITY);
+        const std::uint32_t session = traceSession.load(std::memory_order_relaxed);
+        std::size_t written = 0;
+        file << std::fixed << std::setprecision(3);
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Pacman\"}}";
+        for (std::size_t i = 0; i < claimed; ++i) {
+            const TraceEvent& event = trace[i];
+            if (event.session.load(std::memory_order_acquire) != session) continue;
+            file << ",\n{\"name\":\"" << phaseName(event.phase) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread
+                 << ",\"ts\":" << static_cast<double>(event.start) / 1000.0
+                 << ",\"dur\":" << static_cast<double>(event.duration) / 1000.0 << "}";
+            written++;
+        }
+        file << "\n]}\n";
+
+        file.close();
+        if (!file) {
+            throw std::runtime_error("Failed to write trace file: " + path);
+        }
+        return written;
+    }
+}
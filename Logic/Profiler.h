@@ -0,0 +1,200 @@
+// Logic/Profiler.h
+#ifndef PACMAN_RETRY_PROFILER_H
+#define PACMAN_RETRY_PROFILER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/**
+ * @file Profiler.h
+ * @brief Scoped timers for the phases of a frame, with rolling percentiles and trace export
+ *
+ * Usage:
+ * @code
+ * void World::updatePacmanTileBased(float deltaTime, char input) {
+ *     PROFILE_SCOPE(Pacman);
+ *     ...
+ * }
+ * @endcode
+ *
+ * A scope reads the clock when it is entered and left and adds the
+ * duration to its phase's histogram, which covers the last WINDOW samples.
+ * While a trace is being captured, every scope is also stored as an event
+ * and stopTrace() writes them as Chrome trace-event JSON (chrome://tracing,
+ * Perfetto).
+ *
+ * Profiling is off until setEnabled(true); a disabled scope costs one
+ * relaxed atomic load. With PACMAN_PROFILING set to 0 the scopes compile
+ * to nothing.
+ */
+
+#ifndef PACMAN_PROFILING
+#define PACMAN_PROFILING 1
+#endif
+
+namespace Logic {
+
+    enum class ProfilePhase : std::uint8_t {
+        Frame,    ///< One pass of the window loop
+        Input,    ///< Window events and keyboard sampling
+        Tick,     ///< One World::update
+        Pacman,   ///< Tile-based Pac-Man movement
+        Ghosts,   ///< Target fields and the ghost loop
+        Pickups,  ///< Coin and fruit collection
+        Notify,   ///< Per-frame view notifications
+        Hud,      ///< HUD counters
+        Render,   ///< Renderer pass
+        Display,  ///< Buffer swap, including the frame limiter's wait
+        Count     ///< Number of phases, not a phase
+    };
+
+    /**
+     * @struct PhaseStats
+     * @brief Percentiles of a phase over its recent samples, in microseconds
+     */
+    struct PhaseStats {
+        std::size_t samples = 0;  ///< Samples in the window (at most Profiler::WINDOW)
+        double p50 = 0.0;
+        double p99 = 0.0;
+    };
+
+    /**
+     * @class Profiler
+     * @brief Process-wide per-phase histograms and trace buffer
+     *
+     * Histograms have log-linear buckets (8 per power of two, so a reported
+     * percentile is within about 6% of the measured time). Each phase keeps
+     * the bucket of its last WINDOW samples in a ring; recording a sample
+     * replaces the oldest one and moves one count between buckets, so the
+     * percentiles always describe the recent past and cost O(BUCKETS) to read.
+     *
+     * Thread Safety:
+     * - record(), stats() and reset() may be called from any thread, without locks
+     * - startTrace() and stopTrace() are serialized with a mutex
+     */
+    class Profiler {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr std::size_t WINDOW = 512;             ///< Samples per phase histogram
+        static constexpr std::size_t TRACE_CAPACITY = 1 << 18;  ///< Events per trace; later ones are dropped
+        static constexpr const char* DEFAULT_TRACE_FILE = "../trace.json";
+
+    private:
+        static constexpr std::size_t BUCKETS = 255;
+        static constexpr std::uint8_t EMPTY = 255;  ///< Ring slot without a sample
+
+        struct Histogram {
+            std::atomic<std::size_t> next{0};
+            std::array<std::atomic<std::uint8_t>, WINDOW> ring;   ///< Bucket of each recent sample
+            std::array<std::atomic<std::uint32_t>, BUCKETS> counts;
+        };
+
+        struct TraceEvent {
+            std::int64_t start;     ///< Nanoseconds since startTrace()
+            std::int64_t duration;  ///< Nanoseconds
+            std::uint32_t thread;
+            ProfilePhase phase;
+            std::atomic<std::uint32_t> session{0};  ///< Set last; only events of the current session are written
+        };
+
+        std::array<Histogram, static_cast<std::size_t>(ProfilePhase::Count)> histograms;
+
+        std::mutex traceMutex;
+        std::unique_ptr<TraceEvent[]> trace;  ///< Allocated by the first startTrace()
+        std::atomic<std::size_t> traceCount{0};
+        std::atomic<std::uint32_t> traceSession{0};
+        Clock::time_point traceStart;
+
+        static std::atomic<bool> enabled;
+        static std::atomic<bool> tracing;
+
+        Profiler();
+
+        static std::uint8_t bucketOf(std::uint64_t nanoseconds);
+        static double bucketStart(std::size_t bucket);
+        static std::uint32_t threadIndex();
+
+    public:
+        Profiler(const Profiler&) = delete;
+        Profiler& operator=(const Profiler&) = delete;
+
+        static Profiler& getInstance();
+
+        /// Scopes only measure while enabled (default: off)
+        static void setEnabled(bool on) { enabled.store(on, std::memory_order_relaxed); }
+        static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+        static bool isTracing() { return tracing.load(std::memory_order_relaxed); }
+
+        static const char* phaseName(ProfilePhase phase);
+
+        /**
+         * @brief Adds one measured scope
+         */
+        void record(ProfilePhase phase, Clock::time_point start, Clock::time_point end);
+
+        /**
+         * @brief p50 and p99 of the phase's last WINDOW samples
+         */
+        [[nodiscard]] PhaseStats stats(ProfilePhase phase) const;
+
+        /**
+         * @brief Forgets every sample, e.g. when the overlay is opened again
+         */
+        void reset();
+
+        /**
+         * @brief Starts storing every scope as a trace event (the profiler must be enabled)
+         */
+        void startTrace();
+
+        /**
+         * @brief Stops capturing and writes the events as Chrome trace-event JSON
+         * @param path File to write
+         * @return Number of events written
+         * @throws std::runtime_error if the file cannot be written
+         */
+        std::size_t stopTrace(const std::string& path);
+    };
+
+    /**
+     * @class ProfileScope
+     * @brief Measures the enclosing scope; use PROFILE_SCOPE
+     */
+    class ProfileScope {
+    private:
+        Profiler::Clock::time_point start;
+        ProfilePhase phase;
+        bool active;
+
+    public:
+        explicit ProfileScope(const ProfilePhase phase) : phase(phase), active(Profiler::isEnabled()) {
+            if (active) start = Profiler::Clock::now();
+        }
+
+        ~ProfileScope() {
+            if (active) Profiler::getInstance().record(phase, start, Profiler::Clock::now());
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+    };
+}
+
+#define PACMAN_PROFILE_CONCAT_(a, b) a##b
+#define PACMAN_PROFILE_CONCAT(a, b) PACMAN_PROFILE_CONCAT_(a, b)
+
+#if PACMAN_PROFILING
+#define PROFILE_SCOPE(phase) \
+    const ::Logic::ProfileScope PACMAN_PROFILE_CONCAT(profileScope, __LINE__)(::Logic::ProfilePhase::phase)
+#else
+#define PROFILE_SCOPE(phase) static_cast<void>(::Logic::ProfilePhase::phase)
+#endif
+
+#endif //PACMAN_RETRY_PROFILER_H
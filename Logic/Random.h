@@ -2,35 +2,85 @@
 #ifndef PACMAN_RETRY_RANDOM_H
 #define PACMAN_RETRY_RANDOM_H
 
+#include <cstdint>
 #include <random>
 
-class Random {
-private:
-    std::mt19937 mt;
-    Random() {
-        std::random_device rd;
-        mt.seed(rd());
-    }
-
-public:
-    static Random& getInstance() {
-        static Random instance;
-        return instance;
-    }
-
-    Random(const Random&) = delete;
-    Random& operator=(const Random&) = delete;
-
-    // Returns true with probability p (0.0 to 1.0)
-    bool nextBool(float probability = 0.5f) {
-        std::bernoulli_distribution dist(probability);
-        return dist(mt);
-    }
-
-    int nextInt(int min, int max) {
-        std::uniform_int_distribution<int> dist(min, max);
-        return dist(mt);
-    }
-};
-
-#endif // PACMAN_RETRY_RANDOM_H
\ No newline at end of file
+namespace Logic {
+
+    /**
+     * @class Random
+     * @brief Small, seedable xoshiro128** generator owned by each World
+     *
+     * 16 bytes of state and no heap allocation, so every World can carry its
+     * own instance: a run is reproducible from its seed and several worlds
+     * can run on different threads without sharing a generator.
+     *
+     * Thread Safety:
+     * - NOT thread-safe - one instance per World / per thread
+     */
+    class Random {
+    private:
+        std::uint32_t state[4]{};
+
+        static std::uint32_t rotl(const std::uint32_t x, const int k) {
+            return (x << k) | (x >> (32 - k));
+        }
+
+    public:
+        explicit Random(const std::uint64_t seed) { reseed(seed); }
+
+        // Fresh non-deterministic seed, for games that don't need to be reproducible
+        static std::uint64_t entropySeed() {
+            std::random_device rd;
+            return (static_cast<std::uint64_t>(rd()) << 32) ^ rd();
+        }
+
+        // Expands the 64-bit seed into the full state with splitmix64
+        void reseed(std::uint64_t seed) {
+            for (std::uint32_t& word : state) {
+                seed += 0x9E3779B97F4A7C15ULL;
+                std::uint64_t z = seed;
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+                word = static_cast<std::uint32_t>((z ^ (z >> 31)) >> 32);
+            }
+        }
+
+        // Next raw 32-bit value
+        std::uint32_t next() {
+            const std::uint32_t result = rotl(state[1] * 5, 7) * 9;
+            const std::uint32_t t = state[1] << 9;
+            state[2] ^= state[0];
+            state[3] ^= state[1];
+            state[1] ^= state[2];
+            state[0] ^= state[3];
+            state[2] ^= t;
+            state[3] = rotl(state[3], 11);
+            return result;
+        }
+
+        // Returns true with probability p (0.0 to 1.0)
+        bool nextBool(const float probability = 0.5f) {
+            // Top 24 bits as a float in [0, 1)
+            return static_cast<float>(next() >> 8) * (1.0f / 16777216.0f) < probability;
+        }
+
+        // Uniform integer in [min, max] (Lemire's multiply-shift, no division in the common case)
+        int nextInt(const int min, const int max) {
+            if (max <= min) return min;
+            const std::uint32_t range = static_cast<std::uint32_t>(max - min) + 1u;
+            std::uint64_t product = static_cast<std::uint64_t>(next()) * range;
+            auto low = static_cast<std::uint32_t>(product);
+            if (low < range) {
+                const std::uint32_t threshold = (0u - range) % range;
+                while (low < threshold) {
+                    product = static_cast<std::uint64_t>(next()) * range;
+                    low = static_cast<std::uint32_t>(product);
+                }
+            }
+            return min + static_cast<int>(product >> 32);
+        }
+    };
+}
+
+#endif // PACMAN_RETRY_RANDOM_H
@@ -0,0 +1,150 @@
+// Logic/Replay.cpp
+#include "Replay.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+    constexpr char MAGIC[4] = {'P', 'M', 'R', 'P'};
+    constexpr std::uint32_t VERSION = 1;
+
+    // Header fields are checked against these before anything is allocated
+    constexpr std::uint32_t MAX_MAP_NAME = 4096;         ///< Longer than any path the game opens
+    constexpr std::uint64_t MAX_TICKS = 1ULL << 27;      ///< About 13 days at 120 Hz (128 MiB of inputs)
+
+    // Fixed-width little-endian integers
+    template <typename T>
+    void writeInt(std::ostream& out, T value) {
+        for (std::size_t i = 0; i < sizeof(T); ++i) {
+            out.put(static_cast<char>(static_cast<std::uint64_t>(value) >> (8 * i) & 0xFF));
+        }
+    }
+
+    template <typename T>
+    T readInt(std::istream& in) {
+        std::uint64_t value = 0;
+        for (std::size_t i = 0; i < sizeof(T); ++i) {
+            const int byte = in.get();
+            if (byte == std::char_traits<char>::eof()) {
+                throw std::runtime_error("Replay file is truncated");
+            }
+            value |= static_cast<std::uint64_t>(byte) << (8 * i);
+        }
+        return static_cast<T>(value);
+    }
+
+    // LEB128: 7 bits per byte, high bit set while more bytes follow
+    void writeVarint(std::ostream& out, std::uint64_t value) {
+        while (value >= 0x80) {
+            out.put(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        out.put(static_cast<char>(value));
+    }
+
+    std::uint64_t readVarint(std::istream& in) {
+        std::uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            const auto byte = readInt<std::uint8_t>(in);
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) return value;
+        }
+        throw std::runtime_error("Replay file has a malformed run length");
+    }
+}
+
+namespace Logic {
+
+    Replay::Replay(const std::uint64_t seed, const float tickLength, std::string mapName, const std::uint64_t mapHash)
+        : seed(seed), tickLength(tickLength), mapName(std::move(mapName)), mapHash(mapHash) {}
+
+    void Replay::save(const std::string& filename) const {
+        if (mapName.size() > MAX_MAP_NAME || inputs.size() > MAX_TICKS) {
+            throw std::runtime_error("Replay is too large to save: " + filename);
+        }
+
+        std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to open replay file for writing: " + filename);
+        }
+
+        file.write(MAGIC, sizeof(MAGIC));
+        writeInt<std::uint32_t>(file, VERSION);
+        writeInt<std::uint64_t>(file, seed);
+        std::uint32_t tickBits;
+        std::memcpy(&tickBits, &tickLength, sizeof(tickBits));
+        writeInt<std::uint32_t>(file, tickBits);
+        writeInt<std::uint32_t>(file, static_cast<std::uint32_t>(mapName.size()));
+        file.write(mapName.data(), static_cast<std::streamsize>(mapName.size()));
+        writeInt<std::uint64_t>(file, mapHash);
+        writeInt<std::uint64_t>(file, inputs.size());
+
+        // Run-length encode the inputs
+        for (std::size_t i = 0; i < inputs.size();) {
+            std::size_t run = 1;
+            while (i + run < inputs.size() && inputs[i + run] == inputs[i]) run++;
+            writeInt<std::uint8_t>(file, static_cast<std::uint8_t>(inputs[i]));
+            writeVarint(file, run);
+            i += run;
+        }
+
+        if (!file) {
+            throw std::runtime_error("Failed to write replay file: " + filename);
+        }
+    }
+
+    Replay Replay::load(const std::string& filename) {
+        std::ifstream file(filename, std::ios::binary);
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to open replay file: " + filename);
+        }
+
+        char magic[sizeof(MAGIC)] = {};
+        file.read(magic, sizeof(magic));
+        if (!file || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0) {
+            throw std::runtime_error("Not a replay file: " + filename);
+        }
+        if (const auto version = readInt<std::uint32_t>(file); version != VERSION) {
+            throw std::runtime_error("Unsupported replay version " + std::to_string(version) + ": " + filename);
+        }
+
+        Replay replay;
+        replay.seed = readInt<std::uint64_t>(file);
+        const auto tickBits = readInt<std::uint32_t>(file);
+        std::memcpy(&replay.tickLength, &tickBits, sizeof(tickBits));
+
+        const auto nameLength = readInt<std::uint32_t>(file);
+        if (nameLength > MAX_MAP_NAME) {
+            throw std::runtime_error("Replay file has an invalid map name length");
+        }
+        replay.mapName.resize(nameLength);
+        file.read(replay.mapName.data(), static_cast<std::streamsize>(replay.mapName.size()));
+        if (!file) {
+            throw std::runtime_error("Replay file is truncated");
+        }
+        replay.mapHash = readInt<std::uint64_t>(file);
+
+        const auto tickCount = readInt<std::uint64_t>(file);
+        if (tickCount > MAX_TICKS) {
+            throw std::runtime_error("Replay file has an invalid tick count");
+        }
+
+        // Reserve at most one input per remaining byte; long runs grow the vector as they are read
+        const auto start = file.tellg();
+        file.seekg(0, std::ios::end);
+        const auto remaining = static_cast<std::uint64_t>(file.tellg() - start);
+        file.seekg(start);
+        replay.inputs.reserve(std::min(tickCount, remaining));
+        while (replay.inputs.size() < tickCount) {
+            const auto input = static_cast<char>(readInt<std::uint8_t>(file));
+            const std::uint64_t run = readVarint(file);
+            if (run == 0 || run > tickCount - replay.inputs.size()) {
+                throw std::runtime_error("Replay file has an invalid input run");
+            }
+            replay.inputs.insert(replay.inputs.end(), run, input);
+        }
+
+        return replay;
+    }
+}
@@ -0,0 +1,87 @@
+// Logic/Replay.h
+#ifndef PACMAN_RETRY_REPLAY_H
+#define PACMAN_RETRY_REPLAY_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @file Replay.h
+ * @brief Recorded game input that reproduces a game exactly
+ *
+ * A World is deterministic given its seed, its map, the logic tick length
+ * and the input passed to each World::update call. A Replay stores exactly
+ * those four things, so feeding it back (in the window game or headless)
+ * replays the original game tick for tick.
+ *
+ * File format (little-endian):
+ * - "PMRP" magic, uint32 version
+ * - uint64 seed, float32 tick length
+ * - uint32 map name length + map name bytes, uint64 map hash
+ * - uint64 tick count
+ * - Input runs until tick count is reached: uint8 input + varint run length
+ *
+ * Held keys produce long runs of the same input, so the run-length encoding
+ * keeps a five minute game to a few kilobytes.
+ */
+
+namespace Logic {
+
+    /**
+     * @class Replay
+     * @brief Seed, map identity, tick length and per-tick input of one game
+     */
+    class Replay {
+    private:
+        std::uint64_t seed = 0;
+        float tickLength = 0.0f;
+        std::string mapName;
+        std::uint64_t mapHash = 0;
+        std::vector<char> inputs;  ///< One entry per World::update call
+
+    public:
+        Replay() = default;
+
+        /**
+         * @brief Starts an empty recording
+         * @param seed Seed the World was created with
+         * @param tickLength Delta time passed to every World::update
+         * @param mapName Map file the World loaded
+         * @param mapHash Hash of that map's contents (World::getMapHash)
+         */
+        Replay(std::uint64_t seed, float tickLength, std::string mapName, std::uint64_t mapHash);
+
+        /**
+         * @brief Appends the input of one tick
+         */
+        void record(const char input) { inputs.push_back(input); }
+
+        /**
+         * @brief Input of a tick, or 0 (no input) past the end of the recording
+         */
+        [[nodiscard]] char inputAt(const std::size_t tick) const { return tick < inputs.size() ? inputs[tick] : 0; }
+
+        [[nodiscard]] std::uint64_t getSeed() const { return seed; }
+        [[nodiscard]] float getTickLength() const { return tickLength; }
+        [[nodiscard]] const std::string& getMapName() const { return mapName; }
+        [[nodiscard]] std::uint64_t getMapHash() const { return mapHash; }
+        [[nodiscard]] std::size_t getTickCount() const { return inputs.size(); }
+
+        /**
+         * @brief Writes the replay to a binary file
+         * @throws std::runtime_error if the file cannot be written, or the map name or
+         *         recording is beyond the limits load() accepts
+         */
+        void save(const std::string& filename) const;
+
+        /**
+         * @brief Reads a replay written by save()
+         * @throws std::runtime_error if the file is missing, truncated, not a replay, or its
+         *         header claims an implausible map name length or tick count
+         */
+        static Replay load(const std::string& filename);
+    };
+}
+
+#endif //PACMAN_RETRY_REPLAY_H
@@ -10,15 +10,17 @@
 #include <fstream>
 #include <algorithm>
 #include <iostream>
+#include <memory>
+#include "Leaderboard.h"
+#include "Log.h"
 #include "Observer.h"
-#include "Stopwatch.h"
 
 /**
  * @file Score.h
  * @brief Score calculation system with time-based multipliers and persistent high score storage
  *
  * This file contains two main components:
- * 1. ScoreManager - Handles persistent storage of top 5 high scores to file
+ * 1. ScoreManager - High score table on top of the persistent Leaderboard
  * 2. Score - Calculates current game score with dynamic, skill-based modifiers
  *
  * The Score class implements time-based coin collection multipliers to reward
@@ -34,8 +36,7 @@ namespace Logic {
      * @struct ScoreEntry
      * @brief Represents a single high score entry with player name and score
      *
-     * Used by ScoreManager to store and retrieve high score data from file.
-     * The file format is plain text: "name score" pairs, one per line.
+     * Used by ScoreManager to hand out entries of the persistent leaderboard.
      */
     struct ScoreEntry {
         std::string name;  ///< Player name (max 10 characters in UI)
@@ -60,19 +61,24 @@ namespace Logic {
 
     /**
      * @class ScoreManager
-     * @brief Manages persistent storage of top 5 high scores
+     * @brief High score table of the game, backed by a shared persistent Leaderboard
      *
-     * ScoreManager handles reading and writing high scores to a plain text file.
-     * It maintains a sorted list of the top 5 scores, automatically trimming
-     * lower scores when new ones are added.
+     * Every player keeps only their best score, and the table holds any
+     * number of players; the menu shows the top MAX_SCORES. Ranks and top
+     * lists come from the Leaderboard's in-memory index, so nothing is
+     * re-sorted or re-read per query.
      *
-     * File Format:
-     * - Location: ../scores.txt
-     * - Format: "name score" pairs, one per line
-     * - Example: "Alice 5000\nBob 4500\n"
+     * Files:
+     * - Location: ../scores.idx, ../scores.log and ../scores.lock (see Leaderboard.h)
+     * - Several game instances on one machine can add scores at the same time
+     * - An old plain-text ../scores.txt ("name score" per line) is imported
+     *   the first time the leaderboard is empty
+     *
+     * A broken or unreadable leaderboard is reported on std::cerr and then
+     * behaves as an empty one, so the game still runs.
      *
      * Thread Safety:
-     * - NOT thread-safe - should only be accessed from main game thread
+     * - NOT thread-safe - one ScoreManager per thread (separate instances are safe)
      *
      * Usage Pattern:
      * @code
@@ -84,82 +90,72 @@ namespace Logic {
      * @endcode
      */
     class ScoreManager {
+    public:
+        static constexpr const char* SCORE_FILE = "../scores";             ///< Default leaderboard path, without extension
+        static constexpr const char* LEGACY_SCORE_FILE = "../scores.txt";  ///< Top-5 text file of older versions
+        static constexpr int MAX_SCORES = 5;                                ///< Scores shown in the menu
+
     private:
-        static constexpr const char* SCORE_FILE = "../scores.txt";  ///< Path to high scores file
-        static constexpr int MAX_SCORES = 5;                         ///< Maximum number of scores to store
-        std::vector<ScoreEntry> scores;                              ///< In-memory cache of high scores
+        std::unique_ptr<Leaderboard> leaderboard;  ///< Null if the leaderboard couldn't be opened
 
         /**
-         * @brief Loads scores from file into memory
-         *
-         * Reads the scores.txt file and populates the scores vector.
-         * If the file doesn't exist, the vector remains empty (no scores yet).
-         * Silent failure if file cannot be opened (new installation scenario).
+         * @brief Imports the old text file into an empty leaderboard
          */
-        void loadScores() {
-            scores.clear();
-            std::ifstream file(SCORE_FILE);
-            if (file.is_open()) {
-                std::string name;
-                int score;
-                while (file >> name >> score) {
-                    scores.emplace_back(name, score);
-                }
-                file.close();
+        void importLegacyScores() {
+            std::ifstream file(LEGACY_SCORE_FILE);
+            if (!file.is_open()) return;
+
+            std::string name;
+            int score;
+            while (file >> name >> score) {
+                leaderboard->submit(name, score);
             }
         }
 
+    public:
         /**
-         * @brief Saves current scores from memory to file
-         *
-         * Writes the scores vector to scores.txt, overwriting previous content.
-         * Each entry is written as "name score\n".
-         * Silent failure if file cannot be opened (permission issue).
+         * @brief Opens (or creates) the leaderboard and loads it
+         * @param path Leaderboard path without extension (default: SCORE_FILE)
          */
-        void saveScores() {
-            std::ofstream file(SCORE_FILE);
-            if (file.is_open()) {
-                for (const auto& entry : scores) {
-                    file << entry.name << " " << entry.score << "\n";
-                }
-                file.close();
+        explicit ScoreManager(const std::string& path = SCORE_FILE) {
+            try {
+                leaderboard = std::make_unique<Leaderboard>(path);
+                if (leaderboard->size() == 0 && path == SCORE_FILE) importLegacyScores();
+            } catch (const std::exception& e) {
+                std::cerr << "Failed to open leaderboard: " << e.what() << std::endl;
+                leaderboard.reset();
             }
         }
 
-    public:
         /**
-         * @brief Constructs ScoreManager and loads existing scores
+         * @brief Records a score and saves it
+         * @param name Player name
+         * @param score Score value
          *
-         * Automatically calls loadScores() to populate the in-memory cache.
+         * Kept only if it beats the player's previous best. Appends a
+         * single record to the shared log (see Leaderboard::submit).
          */
-        ScoreManager() {
-            loadScores();
+        void addScore(const std::string& name, int score) {
+            if (!leaderboard) return;
+            try {
+                leaderboard->submit(name, score);
+            } catch (const std::exception& e) {
+                std::cerr << "Failed to save score: " << e.what() << std::endl;
+            }
         }
 
         /**
-         * @brief Adds a new score and saves to file
-         * @param name Player name
-         * @param score Score value
-         *
-         * This method:
-         * 1. Adds the new score to the in-memory vector
-         * 2. Sorts all scores in descending order (highest first)
-         * 3. Trims to top 5 if more than 5 entries exist
-         * 4. Saves the updated list to file
-         *
-         * Note: Does not check if score qualifies for top 5 before adding.
-         * Call isHighScore() first if you want to check eligibility.
+         * @brief Picks up scores added by other ScoreManagers or game instances
+         * @return true if the table changed
          */
-        void addScore(const std::string& name, int score) {
-            scores.emplace_back(name, score);
-            std::sort(scores.begin(), scores.end(),
-                [](const ScoreEntry& a, const ScoreEntry& b) {
-                    return a.score > b.score;
-                });
-            if (scores.size() > MAX_SCORES) {
-                scores.resize(MAX_SCORES);
+        bool refresh() {
+            if (!leaderboard) return false;
+            try {
+                return leaderboard->refresh();
+            } catch (const std::exception& e) {
+                std::cerr << "Failed to read leaderboard: " << e.what() << std::endl;
+                return false;
             }
-            saveScores();
         }
 
         /**
@@ -167,27 +163,37 @@ namespace Logic {
          * @param count Number of scores to retrieve (default 5)
          * @return Vector of ScoreEntry objects, sorted highest to lowest
          *
-         * Always reloads from file before returning to ensure fresh data.
-         * If fewer than count scores exist, returns all available scores.
+         * As of the last load or refresh(); use a LeaderboardWatcher to
+         * follow changes. If fewer than count players exist, returns all of them.
+         */
+        [[nodiscard]] std::vector<ScoreEntry> getTopScores(int count = MAX_SCORES) const {
+            std::vector<ScoreEntry> result;
+            if (!leaderboard || count <= 0) return result;
+            for (auto& entry : leaderboard->top(static_cast<std::size_t>(count))) {
+                result.emplace_back(std::move(entry.name), entry.score);
+            }
+            return result;
+        }
+
+        /**
+         * @brief 1-based rank a score would get among all players
          */
-        std::vector<ScoreEntry> getTopScores(int count = MAX_SCORES) {
-            loadScores();
-            int numScores = std::min(count, static_cast<int>(scores.size()));
-            return std::vector<ScoreEntry>(scores.begin(), scores.begin() + numScores);
+        [[nodiscard]] std::size_t getRank(int score) const {
+            return leaderboard ? leaderboard->rankOf(score) : 1;
         }
 
         /**
-         * @brief Checks if a score qualifies for the top 5
+         * @brief Checks if a score would show in the top MAX_SCORES
          * @param score Score to check
-         * @return true if score would make the top 5 list
-         *
-         * Returns true if:
-         * - Less than 5 scores currently exist (always qualifies), OR
-         * - Score is higher than the current 5th place score
+         * @return true if fewer than MAX_SCORES players score higher
          */
-        bool isHighScore(int score) {
-            if (scores.size() < MAX_SCORES) return true;
-            return score > scores.back().score;
+        [[nodiscard]] bool isHighScore(int score) const {
+            return getRank(score) <= MAX_SCORES;
+        }
+
+        /// Files to watch for changes made by other instances
+        [[nodiscard]] std::vector<std::string> files() const {
+            return leaderboard ? leaderboard->files() : std::vector<std::string>{};
         }
     };
 
@@ -246,7 +252,7 @@ namespace Logic {
      * - Hunt all 4 ghosts during fear mode (max 3000 points) vs. avoid them
      * - Balance speed with survival to maximize score across multiple levels
      *
-     * @see Stopwatch For delta time used in timing calculations
+     * @see World::update For the delta time used in timing calculations
      * @see Observer Base class for event notification pattern
      */
     class Score : public Observer {
@@ -254,6 +260,7 @@ namespace Logic {
         int currentScore;           ///< Running total of points earned
         float timeSinceLastCoin;    ///< Seconds elapsed since last coin collection
         int consecutiveGhosts;      ///< Number of ghosts eaten in current fear mode (combo counter)
+        float lastDeltaTime;        ///< Delta time passed to the most recent update() call
 
         // Score constants
         static constexpr int BASE_COIN_SCORE = 10;        ///< Base points per coin before multiplier
@@ -272,20 +279,20 @@ namespace Logic {
          *
          * Initializes score to 0, timers to 0, and combo counter to 0.
          */
-        Score() : currentScore(0), timeSinceLastCoin(0.0f), consecutiveGhosts(0) {}
+        Score() : currentScore(0), timeSinceLastCoin(0.0f), consecutiveGhosts(0), lastDeltaTime(0.0f) {}
 
         /**
          * @brief Generic notification method (required by Observer interface)
          *
-         * This method is called by Subject::notify(), but the actual event handling
-         * is done through specific methods (onCoinCollected, etc.) called directly
-         * by the World class.
+         * This method is called by Subject::notify(EventType), but the actual event
+         * handling is done through specific methods (onCoinCollected, etc.) called
+         * directly by the World class.
          *
          * Design Note: While this is technically an Observer, we use direct method
          * calls for clarity and type safety rather than encoding event types in
          * a generic notification system.
          */
-        void onNotify() override {
+        void onNotify(EventType) override {
             // Event handling done via specific methods below
         }
 
@@ -297,14 +304,13 @@ namespace Logic {
          * - < 3 seconds: 20 points (2x)
          * - > 3 seconds: 10 points (1x)
          *
-         * Logs the result to console showing multiplier if applicable.
+         * Logs the result (debug level) showing the multiplier if applicable.
          * Resets the timer for the next coin.
          *
          * @note Called by World when Pacman collects a coin
          */
         void onCoinCollected() {
-            Stopwatch& stopwatch = Stopwatch::getInstance();
-            timeSinceLastCoin += stopwatch.getDeltaTime();
+            timeSinceLastCoin += lastDeltaTime;
 
             int multiplier = 1;
             if (timeSinceLastCoin < FAST_COLLECT_TIME) {
@@ -316,11 +322,12 @@ namespace Logic {
             int points = BASE_COIN_SCORE * multiplier;
             currentScore += points;
 
-            std::cout << "Coin collected! +" << points << " points";
             if (multiplier > 1) {
-                std::cout << " (x" << multiplier << " speed bonus!)";
+                LOG_DEBUG(Score) << "Coin collected! +" << points << " points (x" << multiplier
+                                 << " speed bonus!) Total: " << currentScore;
+            } else {
+                LOG_DEBUG(Score) << "Coin collected! +" << points << " points Total: " << currentScore;
             }
-            std::cout << " Total: " << currentScore << std::endl;
 
             timeSinceLastCoin = 0.0f; // Reset timer
         }
@@ -336,7 +343,7 @@ namespace Logic {
         void onFruitCollected() {
             currentScore += FRUIT_SCORE;
             consecutiveGhosts = 0; // Reset ghost combo
-            std::cout << "Fruit collected! +" << FRUIT_SCORE << " points. Total: " << currentScore << std::endl;
+            LOG_DEBUG(Score) << "Fruit collected! +" << FRUIT_SCORE << " points. Total: " << currentScore;
         }
 
         /**
@@ -357,7 +364,7 @@ namespace Logic {
             consecutiveGhosts++;
             int points = BASE_GHOST_SCORE * consecutiveGhosts;
             currentScore += points;
-            std::cout << "Ghost eaten! +" << points << " points (x" << consecutiveGhosts << " combo). Total: " << currentScore << std::endl;
+            LOG_DEBUG(Score) << "Ghost eaten! +" << points << " points (x" << consecutiveGhosts << " combo). Total: " << currentScore;
         }
 
         /**
@@ -372,7 +379,7 @@ namespace Logic {
         void onPacmanDied() {
             consecutiveGhosts = 0; // Reset combo on death
             timeSinceLastCoin = 0.0f; // Reset coin timer
-            std::cout << "Pacman died! Score preserved: " << currentScore << std::endl;
+            LOG_INFO(Score) << "Pacman died! Score preserved: " << currentScore;
         }
 
         /**
@@ -387,7 +394,7 @@ namespace Logic {
             currentScore += LEVEL_CLEAR_BONUS;
             consecutiveGhosts = 0;
             timeSinceLastCoin = 0.0f;
-            std::cout << "Level cleared! +" << LEVEL_CLEAR_BONUS << " bonus points! Total: " << currentScore << std::endl;
+            LOG_INFO(Score) << "Level cleared! +" << LEVEL_CLEAR_BONUS << " bonus points! Total: " << currentScore;
         }
 
         /**
@@ -395,10 +402,12 @@ namespace Logic {
          * @param deltaTime Time elapsed since last update (seconds)
          *
          * Increments the coin collection timer used for multiplier calculation.
-         * Should be called once per frame by World::update().
+         * Should be called once per frame by World::update(). The delta time is
+         * remembered so onCoinCollected() does not need to query the Stopwatch.
          */
         void update(float deltaTime) {
             timeSinceLastCoin += deltaTime;
+            lastDeltaTime = deltaTime;
         }
 
         /**
@@ -0,0 +1,165 @@
+// Logic/ScoreIndex.cpp
+#include "ScoreIndex.h"
+
+#include <algorithm>
+
+namespace Logic {
+
+    void ScoreIndex::update(const std::int32_t node) {
+        nodes[node].size = 1 + sizeOf(nodes[node].left) + sizeOf(nodes[node].right);
+    }
+
+    bool ScoreIndex::before(const Node& node, const int score, const std::string& name) const {
+        if (node.score != score) return node.score > score;
+        return node.name < name;
+    }
+
+    std::int32_t ScoreIndex::allocate(const std::string& name, const int score) {
+        std::int32_t index;
+        if (!freeNodes.empty()) {
+            index = freeNodes.back();
+            freeNodes.pop_back();
+            nodes[index] = Node{};
+        } else {
+            index = static_cast<std::int32_t>(nodes.size());
+            nodes.emplace_back();
+        }
+
+        Node& node = nodes[index];
+        node.name = name;
+        node.score = score;
+        node.priority = rng.next();
+        return index;
+    }
+
+    void ScoreIndex::split(const std::int32_t node, const int score, const std::string& name,
+                           std::int32_t& less, std::int32_t& rest) {
+        if (node == NONE) {
+            less = rest = NONE;
+            return;
+        }
+
+        if (before(nodes[node], score, name)) {
+            split(nodes[node].right, score, name, nodes[node].right, rest);
+            less = node;
+        } else {
+            split(nodes[node].left, score, name, less, nodes[node].left);
+            rest = node;
+        }
+        update(node);
+    }
+
+    std::int32_t ScoreIndex::merge(const std::int32_t a, const std::int32_t b) {
+        // Every key of a is ordered before every key of b
+        if (a == NONE) return b;
+        if (b == NONE) return a;
+
+        if (nodes[a].priority > nodes[b].priority) {
+            nodes[a].right = merge(nodes[a].right, b);
+            update(a);
+            return a;
+        }
+        nodes[b].left = merge(a, nodes[b].left);
+        update(b);
+        return b;
+    }
+
+    void ScoreIndex::insert(const std::string& name, const int score) {
+        std::int32_t less, rest;
+        split(root, score, name, less, rest);
+        root = merge(merge(less, allocate(name, score)), rest);
+    }
+
+    bool ScoreIndex::erase(const std::string& name, const int score) {
+        // Walk down to the node, remembering the link that points at it
+        std::vector<std::int32_t> path;
+        std::int32_t* link = &root;
+        while (*link != NONE) {
+            Node& node = nodes[*link];
+            if (node.score == score && node.name == name) break;
+            path.push_back(*link);
+            link = before(node, score, name) ? &node.right : &node.left;
+        }
+        if (*link == NONE) return false;
+
+        const std::int32_t removed = *link;
+        *link = merge(nodes[removed].left, nodes[removed].right);
+        nodes[removed].name.clear();
+        freeNodes.push_back(removed);
+
+        for (auto it = path.rbegin(); it != path.rend(); ++it) update(*it);
+        return true;
+    }
+
+    void ScoreIndex::assignSorted(const std::vector<RankedScore>& sorted) {
+        clear();
+        nodes.reserve(sorted.size());
+
+        // Cartesian tree build: the right spine lives on a stack, each new (largest) key
+        // becomes the right child of the last spine node with a higher priority
+        std::vector<std::int32_t> spine;
+        for (const RankedScore& entry : sorted) {
+            const std::int32_t node = allocate(entry.name, entry.score);
+            std::int32_t last = NONE;
+            while (!spine.empty() && nodes[spine.back()].priority < nodes[node].priority) {
+                last = spine.back();
+                spine.pop_back();
+            }
+            nodes[node].left = last;
+            if (!spine.empty()) nodes[spine.back()].right = node;
+            spine.push_back(node);
+        }
+        if (!spine.empty()) root = spine.front();
+
+        // Subtree sizes are only known once everything is linked: fix them children first
+        std::vector<std::int32_t> order;
+        order.reserve(nodes.size());
+        if (root != NONE) order.push_back(root);
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            const Node& node = nodes[order[i]];
+            if (node.left != NONE) order.push_back(node.left);
+            if (node.right != NONE) order.push_back(node.right);
+        }
+        for (auto it = order.rbegin(); it != order.rend(); ++it) update(*it);
+    }
+
+    void ScoreIndex::clear() {
+        nodes.clear();
+        freeNodes.clear();
+        root = NONE;
+    }
+
+    std::size_t ScoreIndex::countAbove(const int score) const {
+        std::size_t count = 0;
+        std::int32_t node = root;
+        while (node != NONE) {
+            if (nodes[node].score > score) {
+                count += sizeOf(nodes[node].left) + 1;
+                node = nodes[node].right;
+            } else {
+                node = nodes[node].left;
+            }
+        }
+        return count;
+    }
+
+    std::vector<RankedScore> ScoreIndex::top(const std::size_t count) const {
+        std::vector<RankedScore> result;
+        result.reserve(std::min(count, size()));
+
+        // In-order walk that stops after count entries
+        std::vector<std::int32_t> stack;
+        std::int32_t node = root;
+        while (result.size() < count && (node != NONE || !stack.empty())) {
+            while (node != NONE) {
+                stack.push_back(node);
+                node = nodes[node].left;
+            }
+            node = stack.back();
+            stack.pop_back();
+            result.push_back({nodes[node].name, nodes[node].score});
+            node = nodes[node].right;
+        }
+        return result;
+    }
+}
@@ -0,0 +1,99 @@
+// Logic/ScoreIndex.h
+#ifndef PACMAN_RETRY_SCOREINDEX_H
+#define PACMAN_RETRY_SCOREINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Logic/Random.h"
+
+namespace Logic {
+
+    /**
+     * @struct RankedScore
+     * @brief One player's best score
+     */
+    struct RankedScore {
+        std::string name;
+        int score = 0;
+    };
+
+    /**
+     * @class ScoreIndex
+     * @brief Order-statistic treap of scores, highest first
+     *
+     * Entries are ordered by score (descending), then name, and every node
+     * knows the size of its subtree, so insert, erase and "how many scores
+     * beat X" take O(log n) expected time and the top k take O(log n + k).
+     * Nodes live in one vector and link by index; freed nodes are reused.
+     *
+     * Thread Safety:
+     * - NOT thread-safe
+     */
+    class ScoreIndex {
+    private:
+        static constexpr std::int32_t NONE = -1;
+
+        struct Node {
+            std::string name;
+            int score = 0;
+            std::uint32_t priority = 0;   ///< Max-heap order keeps the tree balanced in expectation
+            std::uint32_t size = 1;       ///< Nodes in this subtree
+            std::int32_t left = NONE;
+            std::int32_t right = NONE;
+        };
+
+        std::vector<Node> nodes;
+        std::vector<std::int32_t> freeNodes;
+        std::int32_t root = NONE;
+        Random rng{0x5C0E1DE7ULL};
+
+        [[nodiscard]] std::uint32_t sizeOf(const std::int32_t node) const { return node == NONE ? 0 : nodes[node].size; }
+        void update(std::int32_t node);
+
+        /// Strict ordering: higher score first, then name
+        [[nodiscard]] bool before(const Node& node, int score, const std::string& name) const;
+
+        std::int32_t allocate(const std::string& name, int score);
+
+        /**
+         * @brief Splits a subtree into the nodes ordered before (score, name) and the rest
+         */
+        void split(std::int32_t node, int score, const std::string& name, std::int32_t& less, std::int32_t& rest);
+        std::int32_t merge(std::int32_t a, std::int32_t b);
+
+    public:
+        /**
+         * @brief Adds an entry; (name, score) must not be present yet
+         */
+        void insert(const std::string& name, int score);
+
+        /**
+         * @brief Removes an entry
+         * @return false if it was not present
+         */
+        bool erase(const std::string& name, int score);
+
+        /**
+         * @brief Replaces the contents with entries already in index order, in O(n)
+         */
+        void assignSorted(const std::vector<RankedScore>& sorted);
+
+        void clear();
+
+        /**
+         * @brief Number of entries with a score strictly higher than score
+         */
+        [[nodiscard]] std::size_t countAbove(int score) const;
+
+        /**
+         * @brief The first count entries, highest first
+         */
+        [[nodiscard]] std::vector<RankedScore> top(std::size_t count) const;
+
+        [[nodiscard]] std::size_t size() const { return sizeOf(root); }
+    };
+}
+
+#endif //PACMAN_RETRY_SCOREINDEX_H
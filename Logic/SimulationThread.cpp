@@ -0,0 +1,64 @@
+// Logic/SimulationThread.cpp
+#include "SimulationThread.h"
+
+#include <utility>
+#include "Logic/World.h"
+
+namespace Logic {
+    SimulationThread::SimulationThread(World& world, const float tickLength, std::function<char()> input)
+        : world(world), tickLength(tickLength), input(std::move(input)) {}
+
+    SimulationThread::~SimulationThread() {
+        stop();
+    }
+
+    void SimulationThread::start() {
+        if (thread.joinable()) {
+            if (isRunning()) return;
+            thread.join();
+        }
+
+        // The World may have changed since the last snapshot (next level), so
+        // the renderer must not pick up one published before
+        snapshots.reset();
+
+        // Sizes, kinds and ghost setup are copied here once; ticks only copy what moves
+        snapshots.forEachBuffer([this](WorldSnapshot& snapshot) { world.captureLevel(snapshot); });
+        running.store(true, std::memory_order_release);
+        thread = std::thread(&SimulationThread::run, this);
+    }
+
+    void SimulationThread::stop() {
+        running.store(false, std::memory_order_release);
+        if (thread.joinable()) thread.join();
+    }
+
+    void SimulationThread::run() {
+        using Clock = std::chrono::steady_clock;
+        const auto step = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(tickLength));
+        auto next = Clock::now() + step;
+
+        while (running.load(std::memory_order_acquire)) {
+            // Leave transitions to the owner, which also has to rebuild the views
+            if (world.isGameOver() || world.isLevelComplete()) break;
+
+            world.update(input(), tickLength);
+            tick++;
+
+            WorldSnapshot& snapshot = snapshots.writeBuffer();
+            world.capture(snapshot);
+            snapshot.tick = tick;
+            snapshot.time = Clock::now();
+            snapshots.publish();
+
+            // After a long stall (debugger, suspended machine) don't replay the backlog in a burst
+            const auto now = Clock::now();
+            if (now - next > step * MAX_CATCH_UP_TICKS) next = now;
+
+            std::this_thread::sleep_until(next);
+            next += step;
+        }
+
+        running.store(false, std::memory_order_release);
+    }
+}
@@ -0,0 +1,87 @@
+// Logic/SimulationThread.h
+#ifndef PACMAN_RETRY_SIMULATIONTHREAD_H
+#define PACMAN_RETRY_SIMULATIONTHREAD_H
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include "Logic/Snapshot.h"
+
+/**
+ * @file SimulationThread.h
+ * @brief Runs World::update at a fixed rate on its own thread
+ *
+ * The thread ticks the World at a fixed rate against the steady clock and
+ * publishes a WorldSnapshot after every tick, so a slow rendered frame no
+ * longer delays the logic (and missed turns), and a slow tick no longer
+ * delays drawing.
+ *
+ * The thread stops by itself when the level is complete or the game is
+ * over. Level transitions, which create and destroy views, therefore always
+ * run on the owning thread while the simulation is stopped.
+ */
+
+namespace Logic {
+    class World;
+
+    /**
+     * @class SimulationThread
+     * @brief Fixed-tick driver of one World, publishing snapshots to a SnapshotBuffer
+     *
+     * While running, the World belongs to the simulation thread. The owner
+     * may only touch it again after stop() or once isRunning() returned false
+     * and stop() was called to join the thread.
+     */
+    class SimulationThread {
+    private:
+        World& world;
+        float tickLength;
+        std::function<char()> input;   ///< Called once per tick on the simulation thread
+        SnapshotBuffer snapshots;
+        std::thread thread;
+        std::atomic<bool> running{false};
+        std::uint64_t tick = 0;
+
+        static constexpr int MAX_CATCH_UP_TICKS = 30;  ///< Beyond this the schedule restarts instead of bursting
+
+        void run();
+
+    public:
+        /**
+         * @param world World to simulate; must outlive this object
+         * @param tickLength Seconds simulated per World::update
+         * @param input Returns the input of the next tick, called on the simulation thread
+         */
+        SimulationThread(World& world, float tickLength, std::function<char()> input);
+        ~SimulationThread();
+
+        SimulationThread(const SimulationThread&) = delete;
+        SimulationThread& operator=(const SimulationThread&) = delete;
+
+        /**
+         * @brief Starts ticking; does nothing if already running
+         *
+         * Every snapshot buffer first gets a full copy of the World
+         * (World::captureLevel), so the ticks only copy what changes.
+         */
+        void start();
+
+        /**
+         * @brief Stops ticking and joins the thread
+         */
+        void stop();
+
+        /**
+         * @brief false once the thread stopped itself (level complete, game over) or was stopped
+         */
+        [[nodiscard]] bool isRunning() const { return running.load(std::memory_order_acquire); }
+
+        /**
+         * @brief Swaps the latest snapshot into the caller's copy
+         * @return false if no tick finished since the last call
+         */
+        bool acquire(WorldSnapshot& into) { return snapshots.acquire(into); }
+    };
+}
+
+#endif //PACMAN_RETRY_SIMULATIONTHREAD_H
@@ -0,0 +1,113 @@
+// Logic/Snapshot.h
+#ifndef PACMAN_RETRY_SNAPSHOT_H
+#define PACMAN_RETRY_SNAPSHOT_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "Logic/EntityStore.h"
+
+/**
+ * @file Snapshot.h
+ * @brief Immutable copy of a World's state, handed from the simulation thread to the renderer
+ *
+ * When the simulation starts, every buffer gets a full copy of the
+ * EntityStore. After every tick the simulation thread copies only what the
+ * tick can change, plus the HUD values, into a WorldSnapshot and publishes
+ * it through a SnapshotBuffer.
+ * The render thread draws only from the latest snapshot it acquired, so it
+ * never reads data the simulation is writing.
+ */
+
+namespace Logic {
+
+    /**
+     * @struct WorldSnapshot
+     * @brief Everything the renderer reads from a World, as of one logic tick
+     */
+    struct WorldSnapshot {
+        EntityStore entities;   ///< Copy of the World's store; per tick only the moving rows and flags are refreshed
+        std::vector<std::uint32_t> pickupChanges;  ///< Rows of pickups collected since pickupEpoch began, in order
+        std::uint32_t pickupEpoch = 0;  ///< Changes when the World rebuilt or put back its pickups; readers then resync all
+        int score = 0;
+        int lives = 0;
+        int level = 0;
+        std::uint64_t tick = 0; ///< Logic ticks simulated since the simulation started
+        std::chrono::steady_clock::time_point time{};  ///< When the tick finished; drives interpolation
+    };
+
+    /**
+     * @class SnapshotBuffer
+     * @brief Lock-free single-producer/single-consumer triple buffer of WorldSnapshots
+     *
+     * The producer always owns one buffer to write, the consumer one to read,
+     * and the third sits in between. Publishing and acquiring each swap a
+     * buffer with the one in between through a single atomic exchange, so
+     * neither side ever waits for the other. Snapshots the consumer skipped
+     * are simply overwritten.
+     *
+     * Buffers are reused, so copying the EntityStore into them stops
+     * allocating once every buffer has been written once.
+     */
+    class SnapshotBuffer {
+    private:
+        static constexpr std::uint8_t INDEX = 0x3;   ///< Buffer index bits of middle
+        static constexpr std::uint8_t FRESH = 0x4;   ///< Set while middle holds a snapshot not yet acquired
+
+        std::array<WorldSnapshot, 3> buffers{};
+        std::atomic<std::uint8_t> middle{1};
+        std::uint8_t back = 0;   ///< Producer only
+        std::uint8_t front = 2;  ///< Consumer only
+
+    public:
+        /**
+         * @brief Buffer the producer fills before calling publish()
+         */
+        WorldSnapshot& writeBuffer() { return buffers[back]; }
+
+        /**
+         * @brief Makes the written buffer the latest snapshot (producer)
+         */
+        void publish() {
+            back = middle.exchange(back | FRESH, std::memory_order_acq_rel) & INDEX;
+        }
+
+        /**
+         * @brief Swaps the latest published snapshot into the consumer's copy (consumer)
+         * @param into Receives the snapshot; its old contents go back into rotation
+         * @return false if nothing was published since the last call
+         */
+        bool acquire(WorldSnapshot& into) {
+            if ((middle.load(std::memory_order_relaxed) & FRESH) == 0) return false;
+            front = middle.exchange(front, std::memory_order_acq_rel) & INDEX;
+            std::swap(into, buffers[front]);
+            return true;
+        }
+
+        /**
+         * @brief Calls fill on each of the three buffers (producer)
+         *
+         * Only call while no producer is running, e.g. to give every buffer
+         * the full EntityStore before restarting the simulation.
+         */
+        template <typename Fill>
+        void forEachBuffer(Fill&& fill) {
+            for (WorldSnapshot& buffer : buffers) fill(buffer);
+        }
+
+        /**
+         * @brief Drops an unacquired snapshot
+         *
+         * Only call while no producer is running, e.g. before restarting the
+         * simulation after the World was changed directly.
+         */
+        void reset() {
+            middle.fetch_and(INDEX, std::memory_order_acq_rel);
+        }
+    };
+}
+
+#endif //PACMAN_RETRY_SNAPSHOT_H
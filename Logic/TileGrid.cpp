@@ -0,0 +1,34 @@
+// Logic/TileGrid.cpp
+#include "TileGrid.h"
+
+namespace Logic {
+
+    void TileGrid::reset(const int columns, const int rows) {
+        width = columns > 0 ? columns : 0;
+        height = rows > 0 ? rows : 0;
+        walls.assign(static_cast<std::size_t>(width) * static_cast<std::size_t>(height), 0);
+        exits.assign(walls.size(), 0);
+    }
+
+    void TileGrid::buildExits() {
+        for (int tileY = 0; tileY < height; ++tileY) {
+            for (int tileX = 0; tileX < width; ++tileX) {
+                std::uint8_t mask = 0;
+                if (!isWall(tileX, tileY)) {
+                    if (!isWall(tileX, tileY - 1)) mask |= Exits::UP;
+                    if (!isWall(tileX, tileY + 1)) mask |= Exits::DOWN;
+                    if (!isWall(tileX - 1, tileY)) mask |= Exits::LEFT;
+                    if (!isWall(tileX + 1, tileY)) mask |= Exits::RIGHT;
+                    if (Exits::count(mask) >= 3) mask |= Exits::JUNCTION;
+                }
+                exits[index(tileX, tileY)] = mask;
+            }
+        }
+    }
+
+    void TileGrid::setWall(const int tileX, const int tileY) {
+        if (inBounds(tileX, tileY)) {
+            walls[index(tileX, tileY)] = 1;
+        }
+    }
+}
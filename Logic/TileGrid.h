@@ -0,0 +1,137 @@
+// Logic/TileGrid.h
+#ifndef PACMAN_RETRY_TILEGRID_H
+#define PACMAN_RETRY_TILEGRID_H
+
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file TileGrid.h
+ * @brief Packed wall occupancy grid for constant-time wall queries
+ *
+ * The map is a fixed grid of tiles, so "is there a wall here?" can be
+ * answered with one array lookup. Walls exist only here: World fills the
+ * grid while parsing the map, uses it for all wall collision checks and
+ * hands it to the factory, which builds the wall layer from it.
+ *
+ * Once the map is parsed, buildExits() also stores which neighbours of each
+ * walkable tile are open, so a ghost can read its options from one byte.
+ */
+
+namespace Logic {
+
+    /**
+     * @brief Bits of a tile's exit mask
+     *
+     * The low four bits are the open directions. JUNCTION is set on tiles with
+     * three or more exits; everywhere else a moving ghost has only one way on.
+     * It stays set when a direction bit is masked off, so Ghost::chooseDirection
+     * can still tell a junction from a corridor after the reverse is removed.
+     */
+    namespace Exits {
+        constexpr std::uint8_t UP = 1;
+        constexpr std::uint8_t DOWN = 2;
+        constexpr std::uint8_t LEFT = 4;
+        constexpr std::uint8_t RIGHT = 8;
+        constexpr std::uint8_t DIRECTIONS = UP | DOWN | LEFT | RIGHT;
+        constexpr std::uint8_t JUNCTION = 16;
+
+        /// Direction letters in bit order
+        constexpr char LETTERS[4] = {'U', 'D', 'L', 'R'};
+
+        /// Bit of a direction letter, 0 for anything else
+        constexpr std::uint8_t bit(const char direction) {
+            switch (direction) {
+                case 'U': return UP;
+                case 'D': return DOWN;
+                case 'L': return LEFT;
+                case 'R': return RIGHT;
+                default: return 0;
+            }
+        }
+
+        /// Number of open directions in a mask
+        constexpr int count(const std::uint8_t mask) { return std::popcount(static_cast<unsigned>(mask & DIRECTIONS)); }
+
+        /// Letter of the lowest open direction, ' ' if none
+        constexpr char first(const std::uint8_t mask) {
+            const unsigned directions = mask & DIRECTIONS;
+            return directions ? LETTERS[std::countr_zero(directions)] : ' ';
+        }
+
+        /// Letter of the n-th open direction (n < count(mask))
+        constexpr char nth(std::uint8_t mask, int n) {
+            unsigned directions = mask & DIRECTIONS;
+            while (n-- > 0) directions &= directions - 1;  // Drop the lowest bit
+            return LETTERS[std::countr_zero(directions)];
+        }
+    }
+
+    /**
+     * @class TileGrid
+     * @brief One byte per tile, row-major, marking which tiles are walls
+     */
+    class TileGrid {
+    private:
+        int width = 0;                   ///< Number of columns
+        int height = 0;                  ///< Number of rows
+        std::vector<std::uint8_t> walls; ///< 1 = wall, 0 = walkable
+        std::vector<std::uint8_t> exits; ///< Exits:: mask per tile, 0 for walls
+
+    public:
+        TileGrid() = default;
+
+        /**
+         * @brief Resizes the grid and marks every tile walkable
+         * @param columns Number of tiles per row
+         * @param rows Number of rows
+         */
+        void reset(int columns, int rows);
+
+        /**
+         * @brief Marks a tile as wall (ignored when out of range)
+         */
+        void setWall(int tileX, int tileY);
+
+        /**
+         * @brief Computes the exit mask of every tile from the walls
+         *
+         * Call once after the last setWall() of a level.
+         */
+        void buildExits();
+
+        /**
+         * @brief Exit mask of a tile (0 for walls and tiles outside the grid)
+         */
+        [[nodiscard]] std::uint8_t exitsAt(int tileX, int tileY) const {
+            if (!inBounds(tileX, tileY)) return 0;
+            return exits[index(tileX, tileY)];
+        }
+
+        /**
+         * @brief Checks whether a tile is a wall
+         * @return true for wall tiles and for tiles outside the grid
+         *
+         * Tiles outside the map count as walls so nothing can leave the grid.
+         */
+        [[nodiscard]] bool isWall(int tileX, int tileY) const {
+            if (!inBounds(tileX, tileY)) return true;
+            return walls[index(tileX, tileY)] != 0;
+        }
+
+        [[nodiscard]] bool inBounds(int tileX, int tileY) const {
+            return tileX >= 0 && tileY >= 0 && tileX < width && tileY < height;
+        }
+
+        /**
+         * @brief Row-major index of a tile (no bounds check)
+         */
+        [[nodiscard]] int index(int tileX, int tileY) const { return tileY * width + tileX; }
+
+        [[nodiscard]] int getWidth() const { return width; }
+        [[nodiscard]] int getHeight() const { return height; }
+    };
+}
+
+#endif //PACMAN_RETRY_TILEGRID_H
@@ -1,46 +1,24 @@
 // Logic/World.cpp - Fixed collision detection
 #include "World.h"
 #include <iostream>
-#include <fstream>
 #include <algorithm>
 #include <stdexcept>
 #include "AbstractFactory.h"
+#include "Log.h"
+#include "Profiler.h"
+#include "Snapshot.h"
 #include "Entities/Coin.h"
 #include "Entities/Fruit.h"
 #include "Entities/Pacman.h"
-#include "Entities/Wall.h"
 #include "Entities/Ghost.h"
 
-int countLines(const std::string& fileName) {
-    std::ifstream file(fileName);
-    if (!file.is_open()) {
-        throw std::runtime_error("Failed to open map file: " + fileName);
-    }
-    int lineCount = 0;
-    std::string line;
-    while (std::getline(file, line)) lineCount++;
-    return lineCount;
-}
-
-int getWidth(const std::string& fileName) {
-    std::ifstream file(fileName);
-    if (!file.is_open()) {
-        throw std::runtime_error("Failed to open map file: " + fileName);
-    }
-    if (std::string line; std::getline(file, line)) return static_cast<int>(line.length());
-    return 0;
-}
-
-float getCenteredPosition(float currentPos, float size) {
-    float shifted = currentPos + 1.0f;
-    int tileIndex = static_cast<int>(shifted / size);
-    float center = (tileIndex * size) + (size / 2.0f);
-    return center - 1.0f;
-}
-
 namespace Logic {
-    World::World(std::shared_ptr<AbstractFactory> factory)
-        : difficulty(1), factory(std::move(factory)), levelCleared(false), gameStarted(false) {
+    World::World(std::shared_ptr<AbstractFactory> factory, const std::uint64_t seed, const std::string& mapPath)
+        : World(std::move(factory), seed, std::make_shared<const LevelSet>(LevelSet::load(mapPath))) {}
+
+    World::World(std::shared_ptr<AbstractFactory> factory, const std::uint64_t seed, std::shared_ptr<const LevelSet> levels)
+        : difficulty(1), factory(std::move(factory)), levelCleared(false), levels(std::move(levels)), seed(seed),
+          rng(seed), gameStarted(false) {
 
         scoreSystem = std::make_unique<Score>();
 
@@ -53,47 +31,60 @@ namespace Logic {
     }
 
     void World::initializeLevel() {
-        std::string filename = "../assets/Map1";
+        // Parsed and validated when the level set was loaded; no file access here
+        const LevelDescription& level = levels->forLevel(currentLevel);
+        builtLevel = &level;
+        pickupChanges.clear();
+        pickupEpoch++;
 
         try {
-            std::ifstream file(filename);
-            if (!file.is_open()) {
-                throw std::runtime_error("Failed to open map file: " + filename);
-            }
+            B_width = 2.0f / static_cast<float>(level.width);
+            B_height = 2.0f / static_cast<float>(level.height);
 
-            auto W_width = static_cast<float>(getWidth(filename));
-            auto W_height = static_cast<float>(countLines(filename));
-            B_width = 2.0f / W_width;
-            B_height = 2.0f / W_height;
+            wallGrid.reset(level.width, level.height);
+            coinSlotByTile.assign(static_cast<std::size_t>(wallGrid.getWidth()) * wallGrid.getHeight(), -1);
 
             float y = -1.0f + B_height/2.0f;
-            std::string line;
-            while (std::getline(file, line)) {
+            for (int row = 0; row < level.height; ++row) {
                 float x = -1.0f + B_width/2.0f;
-                for (char& ch : line) {
+                for (int column = 0; column < level.width; ++column) {
+                    const char ch = level.at(column, row);
                     switch (ch) {
-                        case '#': walls.push_back(factory->createWall(x, y, B_width, B_height)); break;
-                        case '0': coins.push_back(factory->createCoin(x, y, B_width, B_height)); break;
+                        case '#':
+                            wallGrid.setWall(column, row);
+                            break;
+                        case '0':
+                            coinSlotByTile[wallGrid.index(column, row)] = static_cast<int>(coins.size());
+                            coinTiles.push_back(wallGrid.index(column, row));
+                            coins.push_back(factory->createCoin(store, x, y, B_width, B_height));
+                            break;
                         case 'P':
-                            pacman = factory->createPacMan(x, y, B_width, B_height);
+                            pacman = factory->createPacMan(store, x, y, B_width, B_height);
                             // Initialize Pacman's tile position
                             getTileFromPosition(x, y, pacmanTileX, pacmanTileY);
                             pacmanTileProgress = 0.0f;
                             pacmanMoveDir = ' ';
                             pacmanBufferedInput = ' ';
                             break;
-                        case 'f': fruits.push_back(factory->createFruit(x, y, B_width, B_height)); break;
+                        case 'f':
+                            fruitsByTile[wallGrid.index(column, row)] = factory->createFruit(store, x, y, B_width, B_height);
+                            break;
                         case 'R': case 'I': case 'B': case 'O':
-                            ghosts.push_back(factory->createGhost(x, y, B_width, B_height, ch));
+                            ghosts.push_back(factory->createGhost(store, x, y, B_width, B_height, ch));
+                            homeTiles.push_back(wallGrid.index(column, row));
                             break;
-                        case ' ': break;
-                        default: if(ch != '\r' && ch != '\n') std::cerr << "Unknown: " << ch << std::endl;
+                        default: break; // Empty tile; the loader rejected anything else
                     }
                     x += B_width;
                 }
                 y += B_height;
             }
-            std::cout << "Level initialized with " << ghosts.size() << " ghosts." << std::endl;
+            wallGrid.buildExits();
+            factory->createWalls(wallGrid);
+            chaseField.clear();
+            ambushField.clear();
+            homeField.setRoots(wallGrid, homeTiles);
+            LOG_INFO(World) << "Level initialized with " << ghosts.size() << " ghosts.";
 
             gameStarted = false;
 
@@ -104,7 +95,7 @@ namespace Logic {
     }
 
     void World::resetPositions() {
-        std::cout << "=== RESET POSITIONS CALLED ===" << std::endl;
+        LOG_DEBUG(World) << "=== RESET POSITIONS CALLED ===";
 
         // Reset Pacman to spawn position
         pacman->respawn();
@@ -118,12 +109,11 @@ namespace Logic {
         // Reset all ghosts to spawn with their wait timers
         for (auto& ghost : ghosts) {
             ghost->resetForPacmanDeath();
-            ghost->notify();
         }
 
         waitingToRestart = true;
         gameStarted = false;
-        std::cout << "Positions reset. Waiting for player input to restart..." << std::endl;
+        LOG_DEBUG(World) << "Positions reset. Waiting for player input to restart...";
     }
 
     int World::getLives() const {
@@ -135,8 +125,8 @@ namespace Logic {
     }
 
     void World::nextLevel() {
-        std::cout << "=== LEVEL COMPLETE! ===" << std::endl;
-        std::cout << "Moving to level " << (currentLevel + 1) << std::endl;
+        LOG_INFO(World) << "=== LEVEL COMPLETE! ===";
+        LOG_INFO(World) << "Moving to level " << (currentLevel + 1);
 
         scoreSystem->onLevelCleared();
 
@@ -145,17 +135,18 @@ namespace Logic {
         float speedMultiplier = 1.0f + (currentLevel - 1) * 0.15f;
         float newGhostSpeed = 0.30f * speedMultiplier;
 
-        std::cout << "Ghost speed: " << newGhostSpeed << " (multiplier: " << speedMultiplier << "x)" << std::endl;
-
-        coins.clear();
-        fruits.clear();
-        ghosts.clear();
+        LOG_DEBUG(World) << "Ghost speed: " << newGhostSpeed << " (multiplier: " << speedMultiplier << "x)";
 
-        try {
-            initializeLevel();
-        } catch (const std::exception& e) {
-            std::cerr << "Error loading next level: " << e.what() << std::endl;
-            throw;
+        if (&levels->forLevel(currentLevel) == builtLevel) {
+            rewindLevel();
+        } else {
+            clearLevel();
+            try {
+                initializeLevel();
+            } catch (const std::exception& e) {
+                std::cerr << "Error loading next level: " << e.what() << std::endl;
+                throw;
+            }
         }
 
         for (auto& ghost : ghosts) {
@@ -163,75 +154,67 @@ namespace Logic {
         }
 
         pacman->respawn();
+        getTileFromPosition(pacman->getX(), pacman->getY(), pacmanTileX, pacmanTileY);
+        pacmanTileProgress = 0.0f;
+        pacmanMoveDir = ' ';
+        pacmanBufferedInput = ' ';
         waitingToRestart = true;
         gameStarted = false;
 
-        std::cout << "Level " << currentLevel << " ready! Score: " << scoreSystem->getCurrentScore() << std::endl;
+        LOG_INFO(World) << "Level " << currentLevel << " ready! Score: " << scoreSystem->getCurrentScore();
     }
 
-    bool World::wouldCollide(const std::shared_ptr<Entity>& ent, const char dir, const float distance) const {
-        // Calculate test position
-        float testX = ent->getX();
-        float testY = ent->getY();
-
-        switch (dir) {
-            case 'U': testY -= distance; break;
-            case 'D': testY += distance; break;
-            case 'L': testX -= distance; break;
-            case 'R': testX += distance; break;
-            default: return false;
+    void World::rewindLevel() {
+        // Views resync every pickup on a new epoch, so the change list starts over
+        pickupChanges.clear();
+        pickupEpoch++;
+
+        // Collected pickups return to play; slots in coinSlotByTile are rebuilt as they come back
+        for (std::size_t i = 0; i < collectedCoins.size(); ++i) {
+            collectedCoins[i]->reset();
+            coinSlotByTile[collectedCoinTiles[i]] = static_cast<int>(coins.size());
+            coinTiles.push_back(collectedCoinTiles[i]);
+            coins.push_back(std::move(collectedCoins[i]));
         }
+        collectedCoins.clear();
+        collectedCoinTiles.clear();
 
-        // Use standard collision box with small tolerance
-        float w = ent->getWidth();
-        float h = ent->getHeight();
-        float tolerance = 0.08f; // Slightly bigger tolerance than before
-
-        float left = testX - w/2.0f + tolerance;
-        float right = testX + w/2.0f - tolerance;
-        float top = testY - h/2.0f + tolerance;
-        float bottom = testY + h/2.0f - tolerance;
-
-        // Check collision with all walls
-        for (const auto& wall : walls) {
-             float wLeft = wall->getX() - wall->getWidth()/2.0f;
-             float wRight = wall->getX() + wall->getWidth()/2.0f;
-             float wTop = wall->getY() - wall->getHeight()/2.0f;
-             float wBottom = wall->getY() + wall->getHeight()/2.0f;
-
-             // AABB collision test
-             if (right > wLeft && left < wRight && bottom > wTop && top < wBottom) {
-                 return true;
-             }
+        for (auto& [tile, fruit] : collectedFruits) {
+            fruit->reset();
+            fruitsByTile.emplace(tile, std::move(fruit));
         }
-        return false;
-    }
+        collectedFruits.clear();
 
-    bool World::checkGhostWallCollision(const std::shared_ptr<Ghost>& ghost, char dir) const {
-        float cx = getCenteredPosition(ghost->getX(), B_width);
-        float cy = getCenteredPosition(ghost->getY(), B_height);
-
-        float nx = cx;
-        float ny = cy;
-        switch (dir) {
-            case 'U': ny -= B_height; break;
-            case 'D': ny += B_height; break;
-            case 'L': nx -= B_width; break;
-            case 'R': nx += B_width; break;
-            default: return false;
+        // Same state a freshly built ghost and Pacman start in
+        for (auto& ghost : ghosts) {
+            ghost->resetForPacmanDeath();
         }
+        pacman->resetLives();
 
-        float epsilon = B_width * 0.25f;
-        for (const auto& wall : walls) {
-            if (std::abs(wall->getX() - nx) < epsilon &&
-                std::abs(wall->getY() - ny) < epsilon) {
-                return true;
-            }
-        }
-        return false;
+        // Walls, tile grid and home field still describe this map
+        chaseField.clear();
+        ambushField.clear();
+        gameStarted = false;
+    }
+
+    void World::clearLevel() {
+        coins.clear();
+        coinTiles.clear();
+        collectedCoins.clear();
+        collectedCoinTiles.clear();
+        fruitsByTile.clear();
+        collectedFruits.clear();
+        ghosts.clear();
+        homeTiles.clear();
+        factory->clearLevel();
+        builtLevel = nullptr;
     }
 
     bool World::intersectsPickup(const Entity& entity, const Entity& pickup) const {
+        return intersectsPickup(entity, pickup.getHandle().index);
+    }
+
+    bool World::intersectsPickup(const Entity& entity, const std::uint32_t pickupRow) const {
         float shrinkFactor = 0.5f;
 
         float w = entity.getWidth() * shrinkFactor;
@@ -242,19 +225,21 @@ namespace Logic {
         float top = entity.getY() - h / 2.0f;
         float bottom = entity.getY() + h / 2.0f;
 
-        float pickupLeft = pickup.getX() - pickup.getWidth() / 2.0f;
-        float pickupRight = pickup.getX() + pickup.getWidth() / 2.0f;
-        float pickupTop = pickup.getY() - pickup.getHeight() / 2.0f;
-        float pickupBottom = pickup.getY() + pickup.getHeight() / 2.0f;
+        const float pickupX = store.getX(pickupRow), pickupY = store.getY(pickupRow);
+        float pickupLeft = pickupX - store.getWidth(pickupRow) / 2.0f;
+        float pickupRight = pickupX + store.getWidth(pickupRow) / 2.0f;
+        float pickupTop = pickupY - store.getHeight(pickupRow) / 2.0f;
+        float pickupBottom = pickupY + store.getHeight(pickupRow) / 2.0f;
 
         return !(right <= pickupLeft || left >= pickupRight ||
                  bottom <= pickupTop || top >= pickupBottom);
     }
 
-    void World::update(const char input) {
-        Stopwatch& stopwatch = Stopwatch::getInstance();
-        stopwatch.update();
-        const float deltaTime = stopwatch.getDeltaTime();
+    void World::update(const char input, const float deltaTime) {
+        PROFILE_SCOPE(Tick);
+
+        // Interpolation start point for this tick
+        store.storePreviousPositions();
 
         scoreSystem->update(deltaTime);
 
@@ -267,16 +252,10 @@ namespace Logic {
                     scoreSystem->onPacmanDied();
                     resetPositions();
                 } else {
-                    std::cout << "Game Over! Final Score: " << scoreSystem->getCurrentScore() << std::endl;
+                    LOG_INFO(World) << "Game Over! Final Score: " << scoreSystem->getCurrentScore();
                 }
             }
 
-            pacman->notify();
-            for (const auto& wall : walls) wall->notify();
-            for (const auto& coin : coins) coin->notify();
-            for (const auto& fruit : fruits) fruit->notify();
-            for (const auto& ghost : ghosts) ghost->notify();
-
             return;
         }
 
@@ -285,13 +264,8 @@ namespace Logic {
             if (input != 0 && input != ' ') {
                 waitingToRestart = false;
                 gameStarted = true;
-                std::cout << "Game resumed!" << std::endl;
+                LOG_DEBUG(World) << "Game resumed!";
             } else {
-                pacman->notify();
-                for (const auto& wall : walls) wall->notify();
-                for (const auto& coin : coins) coin->notify();
-                for (const auto& fruit : fruits) fruit->notify();
-                for (const auto& ghost : ghosts) ghost->notify();
                 return;
             }
         }
@@ -300,13 +274,8 @@ namespace Logic {
         if (!gameStarted) {
             if (input != 0 && input != ' ') {
                 gameStarted = true;
-                std::cout << "Game started! Ghosts will now move." << std::endl;
+                LOG_DEBUG(World) << "Game started! Ghosts will now move.";
             } else {
-                pacman->notify();
-                for (const auto& wall : walls) wall->notify();
-                for (const auto& coin : coins) coin->notify();
-                for (const auto& fruit : fruits) fruit->notify();
-                for (const auto& ghost : ghosts) ghost->notify();
                 return;
             }
         }
@@ -316,12 +285,19 @@ namespace Logic {
 
         // --- GHOST UPDATE ---
         if (gameStarted) {
-            for (const auto& ghost : ghosts) {
-                if (intersectsPickup(*pacman, *ghost)) {
-                    if (ghost->getState() == GhostState::FEARED) {
+            PROFILE_SCOPE(Ghosts);
+            updateTargetFields();
+
+            // One pass over the ghost rows of the store; ghosts[i] is the handle of ghostRows[i]
+            // (both in creation order) and is only touched to publish events
+            const std::vector<std::uint32_t>& ghostRows = store.ghostRows();
+            for (std::size_t i = 0; i < ghostRows.size(); ++i) {
+                const std::uint32_t row = ghostRows[i];
+                if (intersectsPickup(*pacman, row)) {
+                    if (store.getState(row) == static_cast<int>(GhostState::FEARED)) {
                         scoreSystem->onGhostEaten();
-                        ghost->die();
-                    } else if (ghost->getState() == GhostState::CHASING) {
+                        ghosts[i]->die();
+                    } else if (store.getState(row) == static_cast<int>(GhostState::CHASING)) {
                         pacman->die();
 
                         for (auto& g : ghosts) {
@@ -333,49 +309,44 @@ namespace Logic {
                     }
                 }
 
-                std::vector<char> valid = {'U', 'D', 'L', 'R'};
-                std::erase_if(valid, [&](char dir) {
-                    return checkGhostWallCollision(ghost, dir);
-                });
+                int ghostTileX, ghostTileY;
+                getTileFromPosition(store.getX(row), store.getY(row), ghostTileX, ghostTileY);
+                std::uint8_t exits = wallGrid.exitsAt(ghostTileX, ghostTileY);
 
-                if (valid.size() > 1) {
-                    char opposite = ghost->getOppositeDirection();
-                    std::erase_if(valid, [&](char dir) { return dir == opposite; });
-                }
+                // No turning back unless it is a dead end; eaten ghosts may turn to head home
+                const std::uint8_t reverse = Exits::bit(Ghost::getOppositeDirection(store.getDirection(row)));
+                if (store.getState(row) != static_cast<int>(GhostState::DEAD) && Exits::count(exits & ~reverse) > 0) exits &= ~reverse;
 
-                ghost->update(valid, pacman);
+                const GhostContext context{*pacman, deltaTime, rng, chaseField, ambushField, homeField, ghostTileX, ghostTileY};
+                if (const EventMask changed = Ghost::step(store, row, exits, context); changed != 0) {
+                    ghosts[i]->notify(changed);
+                }
             }
         }
 
-        // --- COIN COLLECTION ---
-        std::erase_if(coins, [&](const std::shared_ptr<Coin>& coin) {
-             if (intersectsPickup(*pacman, *coin)) {
-                 // Don't notify - coin will be destroyed immediately
-                 scoreSystem->onCoinCollected();
-                 return true;  // Remove from vector
-             }
-             return false;
-        });
-
-        // --- FRUIT COLLECTION ---
-        std::erase_if(fruits, [&](const std::shared_ptr<Fruit>& fruit) {
-             if (intersectsPickup(*pacman, *fruit)) {
-                 // Don't notify - fruit will be destroyed immediately
-                 scoreSystem->onFruitCollected();
-
-                 inFruitMode = true;
-
-                 for(auto& g : ghosts) g->setFeared(5.0f);
-                 return true;  // Remove from vector
-             }
-             return false;
-        });
+        // --- COIN & FRUIT COLLECTION ---
+        // Only Pacman's current tile and the tile he is entering can overlap him
+        {
+            PROFILE_SCOPE(Pickups);
+            collectPickupsAt(pacmanTileX, pacmanTileY);
+            if (pacmanMoveDir != ' ' && pacmanTileProgress > 0.0f) {
+                int nextTileX = pacmanTileX;
+                int nextTileY = pacmanTileY;
+                switch (pacmanMoveDir) {
+                    case 'U': nextTileY--; break;
+                    case 'D': nextTileY++; break;
+                    case 'L': nextTileX--; break;
+                    case 'R': nextTileX++; break;
+                }
+                collectPickupsAt(nextTileX, nextTileY);
+            }
+        }
 
         // Check if we've exited fruit mode
         if (inFruitMode) {
             bool anyFeared = false;
-            for (const auto& g : ghosts) {
-                if (g->getState() == GhostState::FEARED) {
+            for (const std::uint32_t row : store.ghostRows()) {
+                if (store.getState(row) == static_cast<int>(GhostState::FEARED)) {
                     anyFeared = true;
                     break;
                 }
@@ -384,18 +355,68 @@ namespace Logic {
                 inFruitMode = false;
             }
         }
+    }
 
-        // Notify remaining entities
-        for (const auto& wall : walls) wall->notify();
-        for (const auto& coin : coins) coin->notify();
-        for (const auto& fruit : fruits) fruit->notify();
-        for (const auto& ghost : ghosts) ghost->notify();
+    void World::notifyViews() const {
+        PROFILE_SCOPE(Notify);
+
+        // Only animated entities get a per-frame event; coins, fruits and walls
+        // are drawn by batched layers that follow the frame snapshot
+        pacman->notify(EventType::AnimationUpdate);
+        for (const auto& ghost : ghosts) ghost->notify(EventType::AnimationUpdate);
+    }
+
+    void World::capture(WorldSnapshot& snapshot) const {
+        store.copyTickTo(snapshot.entities);
+        if (snapshot.pickupEpoch == pickupEpoch && snapshot.pickupChanges.size() <= pickupChanges.size()) {
+            // Same epoch: the snapshot's list is a prefix of ours
+            snapshot.pickupChanges.insert(snapshot.pickupChanges.end(),
+                                          pickupChanges.begin() + static_cast<std::ptrdiff_t>(snapshot.pickupChanges.size()),
+                                          pickupChanges.end());
+        } else {
+            snapshot.pickupChanges = pickupChanges;
+            snapshot.pickupEpoch = pickupEpoch;
+        }
+        snapshot.score = getScore();
+        snapshot.lives = getLives();
+        snapshot.level = currentLevel;
+    }
+
+    void World::captureLevel(WorldSnapshot& snapshot) const {
+        snapshot.entities = store;
+        snapshot.pickupChanges = pickupChanges;
+        snapshot.pickupEpoch = pickupEpoch;
+        snapshot.score = getScore();
+        snapshot.lives = getLives();
+        snapshot.level = currentLevel;
     }
 
     // ============================================
     // TILE-BASED HELPER METHODS
     // ============================================
 
+    void World::updateTargetFields() {
+        chaseField.setRoot(wallGrid, pacmanTileX, pacmanTileY);
+
+        // Walk ahead along Pacman's direction until a wall or AMBUSH_TILES
+        int targetX = pacmanTileX;
+        int targetY = pacmanTileY;
+        int stepX = 0, stepY = 0;
+        switch (pacmanMoveDir) {
+            case 'U': stepY = -1; break;
+            case 'D': stepY = 1; break;
+            case 'L': stepX = -1; break;
+            case 'R': stepX = 1; break;
+            default: break;
+        }
+        for (int i = 0; i < AMBUSH_TILES && (stepX != 0 || stepY != 0); ++i) {
+            if (isTileWall(targetX + stepX, targetY + stepY)) break;
+            targetX += stepX;
+            targetY += stepY;
+        }
+        ambushField.setRoot(wallGrid, targetX, targetY);
+    }
+
     void World::getTileFromPosition(float x, float y, int& outTileX, int& outTileY) const {
         // Convert normalized position [-1, 1] to tile indices
         float shiftedX = x + 1.0f;  // [0, 2]
@@ -412,22 +433,48 @@ namespace Logic {
     }
 
     bool World::isTileWall(int tileX, int tileY) const {
-        // Get position of this tile
-        float x, y;
-        getPositionFromTile(tileX, tileY, x, y);
-
-        // Check if any wall occupies this tile
-        float epsilon = B_width * 0.3f;
-        for (const auto& wall : walls) {
-            if (std::abs(wall->getX() - x) < epsilon &&
-                std::abs(wall->getY() - y) < epsilon) {
-                return true;
-            }
+        return wallGrid.isWall(tileX, tileY);
+    }
+
+    void World::collectPickupsAt(int tileX, int tileY) {
+        if (!wallGrid.inBounds(tileX, tileY)) return;
+        const int tile = wallGrid.index(tileX, tileY);
+
+        if (const int slot = coinSlotByTile[tile]; slot >= 0 && intersectsPickup(*pacman, *coins[slot])) {
+            coins[slot]->collect();
+            scoreSystem->onCoinCollected();
+            pickupChanges.push_back(coins[slot]->getHandle().index);
+
+            // Pooled for the next level on this map
+            collectedCoins.push_back(std::move(coins[slot]));
+            collectedCoinTiles.push_back(tile);
+
+            // Swap-and-pop keeps coins dense without shifting the whole vector
+            const int lastSlot = static_cast<int>(coins.size()) - 1;
+            coins[slot] = std::move(coins[lastSlot]);
+            coinTiles[slot] = coinTiles[lastSlot];
+            coinSlotByTile[coinTiles[slot]] = slot;
+            coins.pop_back();
+            coinTiles.pop_back();
+            coinSlotByTile[tile] = -1;
+        }
+
+        if (const auto it = fruitsByTile.find(tile); it != fruitsByTile.end() && intersectsPickup(*pacman, *it->second)) {
+            it->second->collect();
+            scoreSystem->onFruitCollected();
+            pickupChanges.push_back(it->second->getHandle().index);
+
+            inFruitMode = true;
+
+            for (auto& g : ghosts) g->setFeared(5.0f);
+            collectedFruits.emplace_back(tile, std::move(it->second));
+            fruitsByTile.erase(it);
         }
-        return false;
     }
 
     void World::updatePacmanTileBased(float deltaTime, char input) {
+        PROFILE_SCOPE(Pacman);
+
         // Step 1: Buffer player input
         if (input != 0 && input != ' ') {
             pacmanBufferedInput = input;
@@ -568,6 +615,5 @@ namespace Logic {
 
         // Update Pacman's visual position
         pacman->setPosition(currentX, currentY);
-        pacman->notify();
     }
 }
\ No newline at end of file
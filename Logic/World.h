@@ -1,10 +1,17 @@
 // Logic/World.h
 #ifndef PACMAN_RETRY_WORLD_H
 #define PACMAN_RETRY_WORLD_H
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
-#include "Logic/Stopwatch.h"
+#include "Logic/Random.h"
 #include "Logic/Score.h"
+#include "Logic/DistanceField.h"
+#include "Logic/EntityStore.h"
+#include "Logic/MapLoader.h"
+#include "Logic/TileGrid.h"
 
 /**
  * @file World.h
@@ -19,12 +26,12 @@
  */
 
 namespace Logic {
+    struct WorldSnapshot;
     class AbstractFactory;
     class Pacman;
     class Ghost;
     class Coin;
     class Fruit;
-    class Wall;
     class Entity;
 
     /**
@@ -36,15 +43,34 @@ namespace Logic {
         int difficulty;
         int currentLevel = 1;
         std::shared_ptr<AbstractFactory> factory{};
+        EntityStore store{};  ///< Data of every entity below; declared first so it outlives them
         std::shared_ptr<Pacman> pacman{};
         std::vector<std::shared_ptr<Ghost>> ghosts{};
-        std::vector<std::shared_ptr<Coin>> coins{};
-        std::vector<std::shared_ptr<Fruit>> fruits{};
-        std::vector<std::shared_ptr<Wall>> walls{};
+        std::vector<std::shared_ptr<Coin>> coins{};  ///< Remaining coins (unordered, swap-and-pop on collect)
+        std::vector<int> coinTiles{};                ///< Tile index of each entry in coins
+        std::vector<int> coinSlotByTile{};           ///< Tile index -> slot in coins, -1 if no coin left
+        std::unordered_map<int, std::shared_ptr<Fruit>> fruitsByTile{};  ///< Sparse table of remaining fruits
+        std::vector<std::shared_ptr<Coin>> collectedCoins{};  ///< Pool: hidden until the next level puts them back
+        std::vector<int> collectedCoinTiles{};                ///< Tile index of each entry in collectedCoins
+        std::vector<std::pair<int, std::shared_ptr<Fruit>>> collectedFruits{};  ///< Pool: (tile, fruit)
+        std::vector<std::uint32_t> pickupChanges{};  ///< Rows of pickups collected since pickupEpoch began, in order
+        std::uint32_t pickupEpoch = 0;               ///< Bumped whenever the pickups are rebuilt or put back
+        const LevelDescription* builtLevel = nullptr;  ///< Map the current entities were built from
+        TileGrid wallGrid{};                         ///< Answers every wall query and holds the ghost exit masks
+        DistanceField chaseField{};                  ///< Maze distances to Pacman's tile (Orange)
+        DistanceField ambushField{};                 ///< Maze distances to the tile ahead of Pacman (Pink, Blue)
+        static constexpr int AMBUSH_TILES = 4;       ///< How far ahead of Pacman the ambush target lies
+        DistanceField homeField{};                   ///< Maze distances to the nearest ghost spawn tile, built per level
+        std::vector<int> homeTiles{};                ///< Tile index of every ghost spawn in the map
         bool levelCleared;
         float B_width = 0.0f;   ///< Width of one tile in normalized coordinates
         float B_height = 0.0f;  ///< Height of one tile in normalized coordinates
 
+        std::shared_ptr<const LevelSet> levels;  ///< Maps of successive levels, all in memory
+
+        std::uint64_t seed;  ///< Seed the generator was created with
+        Random rng;          ///< Per-world generator used by all ghost AI
+
         std::unique_ptr<Score> scoreSystem;
         bool inFruitMode = false;
 
@@ -97,17 +123,81 @@ namespace Logic {
         char pacmanBufferedInput = ' ';
 
     public:
-        explicit World(std::shared_ptr<AbstractFactory> factory);
+        static constexpr const char* DEFAULT_MAP = "../assets/Map1";  ///< Map the window game plays
+
+        /**
+         * @param factory Creates the entities (and their views, if any)
+         * @param seed Seed for this world's random generator; the same seed and
+         *             the same inputs replay the same game
+         * @param mapPath Map file, map directory or ".levels" manifest (see LevelSet)
+         * @throws std::runtime_error if the maps can't be loaded or are invalid
+         */
+        explicit World(std::shared_ptr<AbstractFactory> factory, std::uint64_t seed = Random::entropySeed(),
+                       const std::string& mapPath = DEFAULT_MAP);
+
+        /**
+         * @param factory Creates the entities (and their views, if any)
+         * @param seed Seed for this world's random generator
+         * @param levels Already loaded maps; may be shared with other Worlds
+         *
+         * A World shares no mutable state with other Worlds, so independent
+         * games can run on different threads at the same time.
+         */
+        World(std::shared_ptr<AbstractFactory> factory, std::uint64_t seed, std::shared_ptr<const LevelSet> levels);
         ~World() = default;
 
         /**
-         * @brief Main update method called once per frame
+         * @brief Advances the simulation by one logic tick
          * @param input Character representing player input
+         * @param deltaTime Time to simulate in seconds
+         *
+         * Pure simulation: reads no clock and notifies no views. The window
+         * game calls this from a SimulationThread at a fixed rate; the
+         * headless simulator calls it at its own fixed rate. Each tick first stores the previous positions
+         * of moving entities so views can interpolate between the two.
+         */
+        void update(char input, float deltaTime);
+
+        /**
+         * @brief Sends AnimationUpdate to the views of all animated entities once
+         *
+         * Called once per rendered frame, independent of how many logic
+         * ticks ran during that frame. Views only advance their animation
+         * here; drawing happens afterwards in the render pass.
+         *
+         * Safe to call while a SimulationThread is ticking this World: it
+         * only reads the entity list and the subscriptions, which change
+         * only in the constructor and nextLevel().
+         */
+        void notifyViews() const;
+
+        /**
+         * @brief Copies what changed during the last tick and the HUD values into a snapshot
+         * @param snapshot Must have received captureLevel() since the entities were last created
+         *                 or destroyed (constructor, nextLevel())
+         *
+         * Called by the simulation thread after every tick. Only the data
+         * views read per tick is copied (see EntityStore::copyTickTo); sizes,
+         * kinds and ghost setup stay as captureLevel() left them. Pickups
+         * collected since the snapshot was last written are appended to its
+         * pickupChanges.
+         */
+        void capture(WorldSnapshot& snapshot) const;
+
+        /**
+         * @brief Copies all entity data and the HUD values into a snapshot
+         * @param snapshot Receives the copy; reusing one avoids reallocating
+         *
+         * Called for every snapshot buffer when the simulation (re)starts,
+         * and by the owner while the simulation is stopped.
          */
-        void update(char input);
+        void captureLevel(WorldSnapshot& snapshot) const;
 
         /**
-         * @brief Initializes level from map file and sets up tile-based state
+         * @brief Creates every entity of the current level's map and sets up tile-based state
+         *
+         * Only used for the first level and for a level on a different map;
+         * replaying the same map rewinds the existing entities instead.
          */
         void initializeLevel();
 
@@ -117,20 +207,48 @@ namespace Logic {
         void resetPositions();
 
         // Collision detection methods
-        bool wouldCollide(const std::shared_ptr<Entity>& ent, char dir, float distance) const;
-        bool checkGhostWallCollision(const std::shared_ptr<Ghost>& ghost, char dir) const;
         bool intersectsPickup(const Entity& entity, const Entity& pickup) const;
 
         // Getters
         [[nodiscard]] int getScore() const { return scoreSystem->getCurrentScore(); }
         [[nodiscard]] int getLives() const;
         [[nodiscard]] int getCurrentLevel() const { return currentLevel; }
-        [[nodiscard]] bool isLevelComplete() const { return coins.empty(); }
+        [[nodiscard]] std::uint64_t getSeed() const { return seed; }
+        [[nodiscard]] const std::string& getMapName() const { return levels->getName(); }
+        [[nodiscard]] std::uint64_t getMapHash() const { return levels->getHash(); }
+        [[nodiscard]] bool isLevelComplete() const { return coins.empty(); }  ///< O(1): coins only holds uncollected coins
         [[nodiscard]] bool isGameOver() const;
 
+        /**
+         * @brief Advances to the next level
+         *
+         * If the next level plays the same map, the existing entities (and
+         * with them their views) are rewound in place and the collected
+         * pickups come back from their pools, so no entity, view or texture
+         * is created. Otherwise the old level is destroyed and the new map
+         * is built from scratch.
+         */
         void nextLevel();
 
     private:
+        /**
+         * @brief Same test as above against the entity in one store row
+         *
+         * Lets the ghost loop test the rows of EntityStore::ghostRows()
+         * without going through the Ghost objects.
+         */
+        bool intersectsPickup(const Entity& entity, std::uint32_t pickupRow) const;
+
+        /**
+         * @brief Puts the current map's entities back to their level start state
+         */
+        void rewindLevel();
+
+        /**
+         * @brief Destroys every entity of the current level
+         */
+        void clearLevel();
+
         // ============================================
         // TILE-BASED HELPER METHODS
         // ============================================
@@ -161,13 +279,24 @@ namespace Logic {
          * @brief Checks if a tile contains a wall
          * @param tileX Tile X index to check
          * @param tileY Tile Y index to check
-         * @return true if the tile has a wall, false if it's empty/walkable
+         * @return true if the tile has a wall (or lies outside the map)
          *
          * This is the ONLY collision check needed for tile-based movement.
-         * No sub-pixel or floating-point collision detection required!
+         * It is a single lookup in wallGrid, built by initializeLevel().
          */
         bool isTileWall(int tileX, int tileY) const;
 
+        /**
+         * @brief Collects the coin and fruit on one tile if Pacman touches them
+         * @param tileX Tile X index to check
+         * @param tileY Tile Y index to check
+         *
+         * Pacman can only overlap the pickups on his current tile and on the
+         * tile he is moving into, so World::update calls this for those two
+         * tiles instead of testing every remaining coin and fruit.
+         */
+        void collectPickupsAt(int tileX, int tileY);
+
         /**
          * @brief Updates Pacman using tile-based movement logic
          * @param deltaTime Time elapsed since last frame (seconds)
@@ -191,6 +320,15 @@ namespace Logic {
          * on all systems regardless of CPU speed or frame rate.
          */
         void updatePacmanTileBased(float deltaTime, char input);
+
+        /**
+         * @brief Moves the ghost target fields to Pacman's current tile
+         *
+         * The chase field is rooted at Pacman's tile, the ambush field up to
+         * AMBUSH_TILES walkable tiles ahead of him in his move direction.
+         * Each field floods again only when its root tile changed.
+         */
+        void updateTargetFields();
     };
 }
 #endif //PACMAN_RETRY_WORLD_H
\ No newline at end of file
@@ -34,8 +34,10 @@ namespace Render {
     }
 
     void Camera::setWindowSize(const unsigned int width, const unsigned int height) {
+        if (width == windowWidth && height == windowHeight) return;
         windowWidth = width;
         windowHeight = height;
+        ++revision;
     }
 
 } // namespace Render
\ No newline at end of file
@@ -13,6 +13,9 @@ namespace Render {
     private:
         unsigned int windowWidth;
         unsigned int windowHeight;
+        unsigned int revision = 0; // Bumped whenever the transform changes
+        float interpolation = 1.0f; // Fraction of a logic tick elapsed since the last update
+        float frameTime = 0.0f; // Real seconds since the previous rendered frame (0 while paused)
 
     public:
         Camera(unsigned int width, unsigned int height);
@@ -28,6 +31,17 @@ namespace Render {
 
         [[nodiscard]] unsigned int getWindowWidth() const { return windowWidth; }
         [[nodiscard]] unsigned int getWindowHeight() const { return windowHeight; }
+
+        // Lets cached geometry (e.g. the wall layer) detect a resize
+        [[nodiscard]] unsigned int getRevision() const { return revision; }
+
+        // Blend factor between an entity's previous and current logic position [0, 1]
+        void setInterpolation(float alpha) { interpolation = alpha; }
+        [[nodiscard]] float getInterpolation() const { return interpolation; }
+
+        // Time the views advance their animations by this frame
+        void setFrameTime(float seconds) { frameTime = seconds; }
+        [[nodiscard]] float getFrameTime() const { return frameTime; }
     };
 
 } // namespace Render
@@ -6,16 +6,15 @@
 
 #include <utility>
 #include "Camera.h"
+#include "Renderer.h"
 #include "Logic/Entities/Coin.h"
 #include "Logic/Entities/Fruit.h"
 #include "Logic/Entities/Pacman.h"
-#include "Logic/Entities/Wall.h"
 #include "Logic/Entities/GhostsTypes.h"
-#include "views/CoinView.h"
 #include "views/WallView.h"
 #include "views/PacmanView.h"
-#include "views/FruitView.h"
 #include "views/GhostView.h"
+#include "views/PickupBatch.h"
 
 namespace Render {
     void ConcreteFactory::setCamera(std::shared_ptr<Camera> cam) {
@@ -24,68 +23,80 @@ namespace Render {
 
     ConcreteFactory::ConcreteFactory(sf::RenderWindow& window, const std::shared_ptr<Camera>& camera) : window(window) {
         setCamera(camera);
+        wallView = std::make_shared<WallView>(this->camera, window);
+        pickupBatch = std::make_shared<PickupBatch>(frame, this->camera, window);
+
+        // Static layers first so moving entities are drawn on top
+        renderer = std::make_shared<Renderer>();
+        renderer->add(wallView, RenderLayer::Walls);
+        renderer->add(pickupBatch, RenderLayer::Pickups);
     }
 
 
-    std::shared_ptr<Logic::Pacman> ConcreteFactory::createPacMan(float x, float y, float w, float h) {
-        auto pacman = std::make_shared<Logic::Pacman>(x, y, w, h);
-        const auto pacmanView = std::make_shared<PacmanView>(pacman, camera, window);
-        pacman->attach(pacmanView);
+    std::shared_ptr<Logic::Pacman> ConcreteFactory::createPacMan(Logic::EntityStore& store, float x, float y, float w, float h) {
+        auto pacman = arena->make<Logic::Pacman>(store, x, y, w, h);
+        const auto pacmanView = arena->make<PacmanView>(pacman, frame.entities, camera, window);
+        pacman->attach(pacmanView, PacmanView::EVENTS);
+        renderer->add(pacmanView, RenderLayer::Pacman);
         return pacman;
     }
 
-    std::shared_ptr<Logic::Coin> ConcreteFactory::createCoin(float x, float y, float w, float h) {
-        auto coin = std::make_shared<Logic::Coin>(x, y, w, h);
-        const auto coinView = std::make_shared<CoinView>(coin, camera, window);
-        coin->attach(coinView);
+    std::shared_ptr<Logic::Coin> ConcreteFactory::createCoin(Logic::EntityStore& store, float x, float y, float w, float h) {
+        // Pickups are quads in the shared batch, which drops them once they vanish from the frame
+        auto coin = arena->make<Logic::Coin>(store, x, y, w, h);
+        pickupBatch->add(*coin, sf::IntRect(14 * 16, 1 * 16, 16, 16));
         return coin;
     }
 
-    std::shared_ptr<Logic::Ghost> ConcreteFactory::createGhost(float x, float y, float w, float h, char type) {
+    std::shared_ptr<Logic::Ghost> ConcreteFactory::createGhost(Logic::EntityStore& store, float x, float y, float w, float h, char type) {
         std::shared_ptr<Logic::Ghost> ghost;
         int spriteId = 0; // 0=Red, 1=Pink, 2=Blue, 3=Orange
 
         switch (type) {
             case 'R': // Red
-                ghost = std::make_shared<Logic::RedGhost>(x, y, w, h);
+                ghost = arena->make<Logic::RedGhost>(store, x, y, w, h);
                 spriteId = 0;
                 break;
             case 'I': // Pink (Inky/Pinky mapping per your request)
-                 ghost = std::make_shared<Logic::PinkGhost>(x, y, w, h);
+                 ghost = arena->make<Logic::PinkGhost>(store, x, y, w, h);
                  spriteId = 1;
                  break;
             case 'B': // Blue
-                 ghost = std::make_shared<Logic::BlueGhost>(x, y, w, h);
+                 ghost = arena->make<Logic::BlueGhost>(store, x, y, w, h);
                  spriteId = 2;
                  break;
             case 'O': // Orange
-                 ghost = std::make_shared<Logic::OrangeGhost>(x, y, w, h);
+                 ghost = arena->make<Logic::OrangeGhost>(store, x, y, w, h);
                  spriteId = 3;
                  break;
             default: // Fallback
-                ghost = std::make_shared<Logic::RedGhost>(x, y, w, h);
+                ghost = arena->make<Logic::RedGhost>(store, x, y, w, h);
                 spriteId = 0;
                 break;
         }
 
         // Create the view, passing the spriteId so it knows which color to draw
-        auto ghostView = std::make_shared<GhostView>(ghost, camera, window, spriteId);
-        ghost->attach(ghostView);
+        auto ghostView = arena->make<GhostView>(ghost, frame.entities, camera, window, spriteId);
+        ghost->attach(ghostView, GhostView::EVENTS);
+        renderer->add(ghostView, RenderLayer::Ghosts);
 
         return ghost;
     }
 
-    std::shared_ptr<Logic::Wall> ConcreteFactory::createWall(float x, float y, float w, float h) {
-        auto wall = std::make_shared<Logic::Wall>(x, y, w, h);
-        const auto wallView = std::make_shared<WallView>(wall, camera, window);
-        wall->attach(wallView);
-        return wall;
+    void ConcreteFactory::createWalls(const Logic::TileGrid& walls) {
+        // Baked straight from the grid into the shared wall layer
+        wallView->setWalls(walls);
+    }
+
+    void ConcreteFactory::clearLevel() {
+        // Pickup quads go by themselves once their entities are gone from the frame
+        wallView->clear();
+        AbstractFactory::clearLevel();
     }
 
-    std::shared_ptr<Logic::Fruit> ConcreteFactory::createFruit(float x, float y, float w, float h) {
-        auto fruit = std::make_shared<Logic::Fruit>(x, y, w, h);
-        const auto fruitView = std::make_shared<FruitView>(fruit, camera, window);
-        fruit->attach(fruitView);
+    std::shared_ptr<Logic::Fruit> ConcreteFactory::createFruit(Logic::EntityStore& store, float x, float y, float w, float h) {
+        auto fruit = arena->make<Logic::Fruit>(store, x, y, w, h);
+        pickupBatch->add(*fruit, sf::IntRect(6 * 16, 1 * 16, 16, 16));
         return fruit;
     }
 }
@@ -7,25 +7,46 @@
 
 #include <SFML/Graphics/RenderWindow.hpp>
 #include "Logic/AbstractFactory.h"
+#include "Logic/Snapshot.h"
 
 namespace Render {
     class Camera;
+    class WallView;
+    class PickupBatch;
+    class Renderer;
 
     class ConcreteFactory : public Logic::AbstractFactory {
     private:
         std::shared_ptr<Camera> camera;
         sf::RenderWindow& window;
+        std::shared_ptr<WallView> wallView; // Single batched view for all walls
+        std::shared_ptr<PickupBatch> pickupBatch; // Single batched draw for coins and fruits
+        std::shared_ptr<Renderer> renderer; // Draws every view created here, once per frame
+        Logic::WorldSnapshot frame; // What the views draw; the level swaps in the latest snapshot
 
     public:
         ConcreteFactory(sf::RenderWindow& window, const std::shared_ptr<Camera>& camera);
         ~ConcreteFactory() override = default;
         void setCamera(std::shared_ptr<Camera> cam);
 
-        std::shared_ptr<Logic::Pacman> createPacMan(float x, float y, float w, float h) override;
-        std::shared_ptr<Logic::Ghost> createGhost(float x, float y, float w, float h, char type) override;
-        std::shared_ptr<Logic::Coin> createCoin(float x, float y, float w, float h) override;
-        std::shared_ptr<Logic::Fruit> createFruit(float x, float y, float w, float h) override;
-        std::shared_ptr<Logic::Wall> createWall(float x, float y, float w, float h) override;
+        // Static wall layer, drawn once per frame by the level
+        [[nodiscard]] const std::shared_ptr<WallView>& getWallView() const { return wallView; }
+
+        // Coin and fruit quads, drawn once per frame by the level
+        [[nodiscard]] const std::shared_ptr<PickupBatch>& getPickupBatch() const { return pickupBatch; }
+
+        // Render pass over the wall layer, the pickups and every entity view
+        [[nodiscard]] const std::shared_ptr<Renderer>& getRenderer() const { return renderer; }
+
+        // Snapshot every view reads from instead of the World's own store
+        [[nodiscard]] Logic::WorldSnapshot& getFrame() { return frame; }
+
+        std::shared_ptr<Logic::Pacman> createPacMan(Logic::EntityStore& store, float x, float y, float w, float h) override;
+        std::shared_ptr<Logic::Ghost> createGhost(Logic::EntityStore& store, float x, float y, float w, float h, char type) override;
+        std::shared_ptr<Logic::Coin> createCoin(Logic::EntityStore& store, float x, float y, float w, float h) override;
+        std::shared_ptr<Logic::Fruit> createFruit(Logic::EntityStore& store, float x, float y, float w, float h) override;
+        void createWalls(const Logic::TileGrid& walls) override;
+        void clearLevel() override;
     };
 }
 #endif //PACMAN_RETRY_CONCRETEFACTORY_H
\ No newline at end of file
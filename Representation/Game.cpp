@@ -1,5 +1,6 @@
 // Game.cpp
 #include "Game.h"
+#include "Logic/Profiler.h"
 #include "Representation/StateManager/StateManager.h"
 #include "Representation/StateManager/States/State.h"
 
@@ -8,39 +9,44 @@ void Game::run() {
     window.setFramerateLimit(60);
 
     StateManager stateManager;
-    stateManager.push(std::make_unique<MenuState>(window));
+    stateManager.push(std::make_unique<MenuState>(window, options));
 
     while (window.isOpen()) {
-        sf::Event event{};
+        PROFILE_SCOPE(Frame);
 
         // 1. INPUT
-        while (window.pollEvent(event)) {
-            if (event.type == sf::Event::Closed) {
-                window.close();
+        {
+            PROFILE_SCOPE(Input);
+            sf::Event event{};
+            while (window.pollEvent(event)) {
+                if (event.type == sf::Event::Closed) {
+                    window.close();
+                }
+
+                // Handle window resize
+                if (event.type == sf::Event::Resized) {
+                    sf::FloatRect visibleArea(0, 0, event.size.width, event.size.height);
+                    window.setView(sf::View(visibleArea));
+
+                    // Notify the state manager about the resize
+                    stateManager.handleResize(event.size.width, event.size.height);
+                }
+
+                stateManager.processEvents(window, event);
             }
-
-            // Handle window resize
-            if (event.type == sf::Event::Resized) {
-                sf::FloatRect visibleArea(0, 0, event.size.width, event.size.height);
-                window.setView(sf::View(visibleArea));
-
-                // Notify the state manager about the resize
-                stateManager.handleResize(event.size.width, event.size.height);
-            }
-
-            stateManager.processEvents(window, event);
         }
 
-        // 2. CLEAR (Must happen BEFORE update, because update triggers drawing)
-        window.clear();
-
-        // 3. UPDATE (Logic runs -> Notifies Entities -> Views Draw themselves)
+        // 2. UPDATE (Logic runs -> Notifies Entities -> Views update their animation)
         stateManager.update(window);
 
-        // 4. DRAW (Draw UI, Menus, or things not covered by Observers)
+        // 3. CLEAR
+        window.clear();
+
+        // 4. DRAW (Render pass over all views, then UI and menus)
         stateManager.draw(window);
 
         // 5. DISPLAY
+        PROFILE_SCOPE(Display);
         window.display();
     }
 }
\ No newline at end of file
@@ -5,13 +5,28 @@
 #ifndef PACMAN_RETRY_GAME_H
 #define PACMAN_RETRY_GAME_H
 
+#include <string>
+#include <utility>
+
+/**
+ * @brief Command line options of the windowed game
+ */
+struct GameOptions {
+    std::string recordPath;  ///< Save each played game's replay here (empty = don't record)
+    std::string replayPath;  ///< Play this replay instead of reading the keyboard (empty = live play)
+    std::string mapPath;     ///< Map, map directory or ".levels" manifest (empty = the default map)
+    std::string tracePath;   ///< Where F4 writes the profiler trace (empty = Profiler::DEFAULT_TRACE_FILE)
+};
 
 class Game {
+private:
+    GameOptions options;
+
 public:
-    Game() = default;
+    explicit Game(GameOptions options = {}) : options(std::move(options)) {}
     ~Game() = default;
 
-    static void run();
+    void run();
 };
 
 
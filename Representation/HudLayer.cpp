@@ -0,0 +1,131 @@
+//
+// HudLayer.cpp
+//
+
+#include "HudLayer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Render {
+    HudLayer::HudLayer(const sf::Font& font, const unsigned characterSize, sf::RenderWindow& window) : window(window) {
+        bakeAtlas(font, characterSize);
+    }
+
+    void HudLayer::bakeAtlas(const sf::Font& font, const unsigned characterSize) {
+        // One cell per glyph, wide enough for the widest advance
+        float widest = 0.0f;
+        for (char ch = FIRST_GLYPH; ch <= LAST_GLYPH; ++ch) {
+            const float advance = font.getGlyph(static_cast<sf::Uint32>(ch), characterSize, false).advance;
+            advances[ch - FIRST_GLYPH] = advance;
+            widest = std::max(widest, advance);
+            if (ch >= '0' && ch <= '9') digitAdvance = std::max(digitAdvance, advance);
+        }
+        cellSize = sf::Vector2f(std::ceil(widest + 2.0f * CELL_PADDING), std::ceil(font.getLineSpacing(characterSize)));
+
+        constexpr unsigned glyphCount = LAST_GLYPH - FIRST_GLYPH + 1;
+        constexpr unsigned rows = (glyphCount + ATLAS_COLUMNS - 1) / ATLAS_COLUMNS;
+        if (!atlas.create(static_cast<unsigned>(cellSize.x) * ATLAS_COLUMNS, static_cast<unsigned>(cellSize.y) * rows)) {
+            throw std::runtime_error("Failed to create HUD glyph atlas");
+        }
+
+        // White glyphs on transparent cells; quads tint them through their vertex color
+        atlas.clear(sf::Color::Transparent);
+        sf::Text glyph;
+        glyph.setFont(font);
+        glyph.setCharacterSize(characterSize);
+        glyph.setFillColor(sf::Color::White);
+        for (unsigned i = 0; i < glyphCount; ++i) {
+            glyph.setString(std::string(1, static_cast<char>(FIRST_GLYPH + i)));
+            glyph.setPosition(static_cast<float>(i % ATLAS_COLUMNS) * cellSize.x + CELL_PADDING,
+                              static_cast<float>(i / ATLAS_COLUMNS) * cellSize.y);
+            atlas.draw(glyph);
+        }
+        atlas.display();
+    }
+
+    std::size_t HudLayer::addQuads(const std::size_t count) {
+        const std::size_t first = vertices.getVertexCount() / 6;
+        vertices.resize((first + count) * 6);
+        return first;
+    }
+
+    void HudLayer::writeQuad(const std::size_t quad, const char ch, const sf::Vector2f position, const sf::Color color) {
+        sf::Vertex* vertex = &vertices[quad * 6];
+
+        if (ch <= FIRST_GLYPH || ch > LAST_GLYPH) {
+            // Blank slot: degenerate triangles draw nothing
+            for (int i = 0; i < 6; ++i) vertex[i] = sf::Vertex();
+            return;
+        }
+
+        const unsigned cell = static_cast<unsigned>(ch - FIRST_GLYPH);
+        const float u = static_cast<float>(cell % ATLAS_COLUMNS) * cellSize.x;
+        const float v = static_cast<float>(cell / ATLAS_COLUMNS) * cellSize.y;
+
+        // The glyph sits CELL_PADDING into its cell, so shift the quad back to put it at the pen position
+        const float left = position.x - CELL_PADDING;
+        const float top = position.y;
+        const float right = left + cellSize.x;
+        const float bottom = top + cellSize.y;
+
+        vertex[0] = sf::Vertex(sf::Vector2f(left, top), color, sf::Vector2f(u, v));
+        vertex[1] = sf::Vertex(sf::Vector2f(right, top), color, sf::Vector2f(u + cellSize.x, v));
+        vertex[2] = sf::Vertex(sf::Vector2f(right, bottom), color, sf::Vector2f(u + cellSize.x, v + cellSize.y));
+        vertex[3] = vertex[0];
+        vertex[4] = vertex[2];
+        vertex[5] = sf::Vertex(sf::Vector2f(left, bottom), color, sf::Vector2f(u, v + cellSize.y));
+    }
+
+    std::size_t HudLayer::addCounter(const std::string& label, sf::Vector2f position, const sf::Color color,
+                                     const std::size_t digits) {
+        // The label never changes: write it once
+        const std::size_t labelQuads = addQuads(label.size());
+        for (std::size_t i = 0; i < label.size(); ++i) {
+            writeQuad(labelQuads + i, label[i], position, color);
+            if (label[i] >= FIRST_GLYPH && label[i] <= LAST_GLYPH) position.x += advances[label[i] - FIRST_GLYPH];
+        }
+
+        const std::size_t firstDigit = addQuads(digits);
+        for (std::size_t i = 0; i < digits; ++i) writeQuad(firstDigit + i, ' ', position, color);
+
+        // Nothing shown yet, so the first set() writes every digit
+        counters.push_back({firstDigit, digits, position, color, std::nullopt, std::string(digits, ' ')});
+        return counters.size() - 1;
+    }
+
+    void HudLayer::set(const std::size_t counter, const long long value) {
+        Counter& shown = counters[counter];
+        if (value == shown.value) return;
+        shown.value = value;
+
+        // Right-to-left digits into a fixed buffer, no allocation
+        char text[24];
+        std::size_t length = 0;
+        unsigned long long magnitude = value < 0 ? 0ULL - static_cast<unsigned long long>(value) : static_cast<unsigned long long>(value);
+        do {
+            text[length++] = static_cast<char>('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude > 0 && length < sizeof(text) - 1);
+        if (value < 0) text[length++] = '-';
+        std::reverse(text, text + length);
+
+        if (length > shown.digits) {
+            length = shown.digits;
+            std::fill(text, text + length, '9');
+        }
+
+        for (std::size_t i = 0; i < shown.digits; ++i) {
+            const char ch = i < length ? text[i] : ' ';
+            if (ch == shown.shown[i]) continue;
+            shown.shown[i] = ch;
+            const sf::Vector2f position(shown.position.x + static_cast<float>(i) * digitAdvance, shown.position.y);
+            writeQuad(shown.firstDigit + i, ch, position, shown.color);
+        }
+    }
+
+    void HudLayer::draw() {
+        window.draw(vertices, &atlas.getTexture());
+    }
+}
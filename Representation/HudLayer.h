@@ -0,0 +1,88 @@
+//
+// HudLayer.h - Retained HUD drawn from a baked glyph atlas
+//
+
+#ifndef PACMAN_RETRY_HUDLAYER_H
+#define PACMAN_RETRY_HUDLAYER_H
+
+#include <array>
+#include <optional>
+#include <string>
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include "Representation/Renderer.h"
+
+namespace Render {
+
+    /**
+     * @class HudLayer
+     * @brief Labelled counters ("Score: 1234") as quads of one vertex array
+     *
+     * The printable ASCII glyphs of the font are rendered once into an atlas
+     * (a RenderTexture, one fixed-size cell per character). Every character
+     * on screen is one quad sampling its cell, tinted by its vertex color.
+     * Labels are written once; setting a counter compares the new value
+     * with the shown one and rewrites only the digit quads that differ, so
+     * an unchanged HUD costs nothing but its single draw call.
+     *
+     * Counters are left aligned with a fixed number of digit slots; digits
+     * use the widest digit advance so they don't shift as the value changes.
+     */
+    class HudLayer final : public Drawable {
+    private:
+        static constexpr char FIRST_GLYPH = ' ';
+        static constexpr char LAST_GLYPH = '~';
+        static constexpr unsigned ATLAS_COLUMNS = 16;
+        static constexpr float CELL_PADDING = 2.0f;  ///< Room for glyphs that overhang their advance
+
+        struct Counter {
+            std::size_t firstDigit;  ///< Quad index of the first digit slot
+            std::size_t digits;      ///< Digit slots
+            sf::Vector2f position;   ///< Top left of the first digit slot
+            sf::Color color;
+            std::optional<long long> value;
+            std::string shown;       ///< One character per digit slot, ' ' when empty
+        };
+
+        sf::RenderTexture atlas;
+        sf::Vector2f cellSize;
+        float digitAdvance = 0.0f;
+        std::array<float, LAST_GLYPH - FIRST_GLYPH + 1> advances{};
+
+        sf::VertexArray vertices{sf::Triangles};
+        std::vector<Counter> counters;
+        sf::RenderWindow& window;
+
+        void bakeAtlas(const sf::Font& font, unsigned characterSize);
+        void writeQuad(std::size_t quad, char ch, sf::Vector2f position, sf::Color color);
+        std::size_t addQuads(std::size_t count);
+
+    public:
+        /**
+         * @param font Font to bake; only needed during construction
+         * @param characterSize Pixel size of the glyphs
+         * @param window Target of draw()
+         */
+        HudLayer(const sf::Font& font, unsigned characterSize, sf::RenderWindow& window);
+
+        /**
+         * @brief Adds a label followed by a number
+         * @param label Static text in front of the number
+         * @param position Top left corner, in window pixels
+         * @param color Tint of label and digits
+         * @param digits Digit slots; larger values show as all nines
+         * @return Id to pass to set()
+         */
+        std::size_t addCounter(const std::string& label, sf::Vector2f position, sf::Color color, std::size_t digits);
+
+        /**
+         * @brief Shows a new value; returns at once if it is already shown
+         */
+        void set(std::size_t counter, long long value);
+
+        void draw() override;
+        [[nodiscard]] const sf::Texture* getTexture() const override { return &atlas.getTexture(); }
+    };
+}
+
+#endif //PACMAN_RETRY_HUDLAYER_H
@@ -0,0 +1,37 @@
+//
+// Renderer.cpp - Ordered render pass over all views
+//
+
+#include "Renderer.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace Render {
+
+    void Renderer::add(const std::shared_ptr<Drawable>& drawable, const RenderLayer layer) {
+        const Entry entry{drawable, layer, drawable->getTexture()};
+
+        // Insert after equal keys, so drawables with the same layer and texture keep registration order
+        const auto before = [](const Entry& a, const Entry& b) {
+            if (a.layer != b.layer) return a.layer < b.layer;
+            return std::less<const sf::Texture*>()(a.texture, b.texture);
+        };
+        entries.insert(std::upper_bound(entries.begin(), entries.end(), entry, before), entry);
+    }
+
+    void Renderer::render() {
+        bool expired = false;
+        for (const Entry& entry : entries) {
+            if (const auto drawable = entry.drawable.lock()) {
+                drawable->draw();
+            } else {
+                expired = true;
+            }
+        }
+
+        if (expired) {
+            std::erase_if(entries, [](const Entry& entry) { return entry.drawable.expired(); });
+        }
+    }
+}
@@ -0,0 +1,88 @@
+//
+// Renderer.h - Ordered render pass over all views
+//
+
+#ifndef PACMAN_RETRY_RENDERER_H
+#define PACMAN_RETRY_RENDERER_H
+
+#include <memory>
+#include <vector>
+
+namespace sf {
+    class Texture;
+}
+
+namespace Render {
+
+    /**
+     * @class Drawable
+     * @brief Anything the render pass can draw
+     */
+    class Drawable {
+    public:
+        virtual ~Drawable() = default;
+
+        virtual void draw() = 0;
+
+        /// Texture the draw binds, used to group draws; nullptr for untextured geometry
+        [[nodiscard]] virtual const sf::Texture* getTexture() const { return nullptr; }
+    };
+
+    /**
+     * @brief Draw order of the level, back to front
+     */
+    enum class RenderLayer {
+        Walls,
+        Pickups,
+        Pacman,
+        Ghosts,
+        Hud
+    };
+
+    /**
+     * @class Renderer
+     * @brief Draws every registered view once per frame in a fixed order
+     *
+     * Logic never draws: entities only publish events and views only update
+     * their own state in onNotify(). Once per frame the level calls render(),
+     * which walks the registered drawables by layer and, within a layer, by
+     * texture, so consecutive draws share texture state and can be batched.
+     *
+     * The renderer does not own the drawables. Views die with their entity,
+     * and their entries are dropped on the next render().
+     */
+    class Renderer {
+    private:
+        struct Entry {
+            std::weak_ptr<Drawable> drawable;
+            RenderLayer layer;
+            const sf::Texture* texture;
+        };
+
+        std::vector<Entry> entries;  ///< Sorted by (layer, texture)
+
+    public:
+        Renderer() = default;
+
+        /**
+         * @brief Registers a drawable for every following frame
+         * @param drawable View or layer to draw
+         * @param layer Where in the draw order it belongs
+         */
+        void add(const std::shared_ptr<Drawable>& drawable, RenderLayer layer);
+
+        /**
+         * @brief Draws all live drawables, back to front
+         */
+        void render();
+
+        /**
+         * @brief Forgets every drawable
+         */
+        void clear() { entries.clear(); }
+
+        [[nodiscard]] std::size_t size() const { return entries.size(); }
+    };
+}
+
+#endif //PACMAN_RETRY_RENDERER_H
@@ -0,0 +1,43 @@
+//
+// ResourceCache.cpp
+//
+
+#include "ResourceCache.h"
+#include <stdexcept>
+
+namespace Render {
+
+    ResourceCache& ResourceCache::getInstance() {
+        static ResourceCache instance;
+        return instance;
+    }
+
+    std::shared_ptr<const sf::Texture> ResourceCache::getTexture(const std::string& filename) {
+        if (auto cached = textures[filename].lock()) {
+            return cached;
+        }
+
+        auto texture = std::make_shared<sf::Texture>();
+        if (!texture->loadFromFile(filename)) {
+            throw std::runtime_error("Failed to load texture file: " + filename);
+        }
+
+        textures[filename] = texture;
+        return texture;
+    }
+
+    std::shared_ptr<const sf::Font> ResourceCache::getFont(const std::string& filename) {
+        if (auto cached = fonts[filename].lock()) {
+            return cached;
+        }
+
+        auto font = std::make_shared<sf::Font>();
+        if (!font->loadFromFile(filename)) {
+            throw std::runtime_error("Failed to load font file: " + filename);
+        }
+
+        fonts[filename] = font;
+        return font;
+    }
+
+} // namespace Render
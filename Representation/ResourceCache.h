@@ -0,0 +1,64 @@
+//
+// ResourceCache.h - Shared textures and fonts (Singleton pattern)
+//
+
+#ifndef PACMAN_RETRY_RESOURCECACHE_H
+#define PACMAN_RETRY_RESOURCECACHE_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+namespace Render {
+
+    /// Sprite sheet used by every entity view
+    inline constexpr const char* SPRITESHEET_PATH = "../assets/spritesheet.png";
+    /// Font used by every state
+    inline constexpr const char* FONT_PATH = "../assets/DejaVuSans.ttf";
+
+    /**
+     * @class ResourceCache
+     * @brief Loads each texture/font file once and hands out shared handles
+     *
+     * The cache only holds weak references: a file is decoded on the first
+     * request, every later request for the same path gets the same object,
+     * and the resource is freed when the last handle (view or state) is
+     * destroyed. The next request after that loads it again.
+     *
+     * Thread Safety:
+     * - NOT thread-safe - only call from the thread that owns the window
+     */
+    class ResourceCache {
+    private:
+        std::unordered_map<std::string, std::weak_ptr<const sf::Texture>> textures;
+        std::unordered_map<std::string, std::weak_ptr<const sf::Font>> fonts;
+
+        // Private constructor
+        ResourceCache() = default;
+
+    public:
+        // Delete copy constructor and assignment operator
+        ResourceCache(const ResourceCache&) = delete;
+        ResourceCache& operator=(const ResourceCache&) = delete;
+
+        // Get singleton instance
+        static ResourceCache& getInstance();
+
+        /**
+         * @brief Returns the texture for a file, loading it if no handle is alive
+         * @throws std::runtime_error if the file cannot be loaded
+         */
+        std::shared_ptr<const sf::Texture> getTexture(const std::string& filename);
+
+        /**
+         * @brief Returns the font for a file, loading it if no handle is alive
+         * @throws std::runtime_error if the file cannot be loaded
+         */
+        std::shared_ptr<const sf::Font> getFont(const std::string& filename);
+    };
+
+} // namespace Render
+
+#endif //PACMAN_RETRY_RESOURCECACHE_H
@@ -1,33 +1,52 @@
 // Representation/StateManager/States/State.cpp
 #include "State.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
 #include <memory>
 #include <iostream>
+#include <sstream>
 
 #include "Logic/World.h"
 #include "Logic/Score.h"
+#include "Logic/LeaderboardWatcher.h"
+#include "Logic/Profiler.h"
+#include "Logic/SimulationThread.h"
 #include "Representation/Camera.h"
 #include "Representation/ConcreteFactory.h"
+#include "Representation/Renderer.h"
+#include "Representation/ResourceCache.h"
 #include "Representation/StateManager/StateManager.h"
 
+namespace {
+    // Shared UI font; falls back to an empty font so a missing file is not fatal
+    std::shared_ptr<const sf::Font> loadFont() {
+        try {
+            return Render::ResourceCache::getInstance().getFont(Render::FONT_PATH);
+        } catch (const std::exception& e) {
+            std::cerr << "Failed to load font! " << e.what() << std::endl;
+            return std::make_shared<sf::Font>();
+        }
+    }
+}
+
 // ============================================
 // MENU STATE
 // ============================================
 
-MenuState::MenuState(sf::RenderWindow& window) {
+MenuState::MenuState(sf::RenderWindow& window, GameOptions options) : options(std::move(options)) {
     windowSize = window.getSize();
 
-    if (!font.loadFromFile("../assets/DejaVuSans.ttf")) {
-        std::cerr << "Failed to load font!" << std::endl;
-    }
+    font = loadFont();
 
     // Setup Title
-    titleText.setFont(font);
+    titleText.setFont(*font);
     titleText.setString("PAC-MAN");
     titleText.setCharacterSize(60);
     titleText.setFillColor(sf::Color::Yellow);
 
     // Setup Leaderboard Title
-    leaderboardTitleText.setFont(font);
+    leaderboardTitleText.setFont(*font);
     leaderboardTitleText.setString("TOP 5 SCORES");
     leaderboardTitleText.setCharacterSize(30);
     leaderboardTitleText.setFillColor(sf::Color::White);
@@ -38,16 +57,19 @@ MenuState::MenuState(sf::RenderWindow& window) {
     playButton.setOutlineThickness(3);
     playButton.setOutlineColor(sf::Color::White);
 
-    playButtonText.setFont(font);
+    playButtonText.setFont(*font);
     playButtonText.setString("PLAY");
     playButtonText.setCharacterSize(30);
     playButtonText.setFillColor(sf::Color::White);
 
     // Load scores and position UI
+    leaderboard = std::make_unique<Logic::LeaderboardWatcher>();
     loadScores();
     repositionUI();
 }
 
+MenuState::~MenuState() = default;
+
 void MenuState::repositionUI() {
     float centerX = windowSize.x / 2.0f;
 
@@ -80,12 +102,13 @@ void MenuState::repositionUI() {
 void MenuState::loadScores() {
     scoreTexts.clear();
 
-    Logic::ScoreManager scoreManager;
-    auto topScores = scoreManager.getTopScores(5);
+    // Version first: a reload that lands in between is picked up next frame
+    leaderboardVersion = leaderboard->getVersion();
+    auto topScores = leaderboard->getScores();
 
     for (size_t i = 0; i < 5; ++i) {
         sf::Text scoreText;
-        scoreText.setFont(font);
+        scoreText.setFont(*font);
 
         if (i < topScores.size()) {
             scoreText.setString(std::to_string(i + 1) + ". " +
@@ -108,8 +131,11 @@ void MenuState::handleResize(unsigned int width, unsigned int height) {
 }
 
 void MenuState::update(sf::RenderWindow& window, StateManager& stateManager) {
-    loadScores();
-    repositionUI();
+    // The watcher thread reads the file; the menu only rebuilds its texts when the scores changed
+    if (leaderboard->getVersion() != leaderboardVersion) {
+        loadScores();
+        repositionUI();
+    }
 }
 
 void MenuState::draw(sf::RenderWindow& window) {
@@ -131,7 +157,7 @@ void MenuState::processEvents(const sf::Event& event, sf::RenderWindow& window,
     if (event.type == sf::Event::MouseButtonPressed &&
         event.mouseButton.button == sf::Mouse::Left &&
         playButton.getGlobalBounds().contains(worldPos)) {
-        stateManager.push(std::make_unique<LevelState>(window));
+        stateManager.push(std::make_unique<LevelState>(window, options));
         return;
     }
 
@@ -146,29 +172,96 @@ void MenuState::processEvents(const sf::Event& event, sf::RenderWindow& window,
 // LEVEL STATE
 // ============================================
 
-LevelState::LevelState(sf::RenderWindow &window) {
+LevelState::LevelState(sf::RenderWindow &window, const GameOptions& options) {
     camera = std::make_shared<Render::Camera>(window.getSize().x, window.getSize().y);
     factory = std::make_shared<Render::ConcreteFactory>(window, camera);
-    world = std::make_unique<Logic::World>(factory);
 
-    if (!font.loadFromFile("../assets/DejaVuSans.ttf")) {
-        std::cerr << "Failed to load font for UI!" << std::endl;
+    if (!options.replayPath.empty()) {
+        try {
+            playback = Logic::Replay::load(options.replayPath);
+        } catch (const std::exception& e) {
+            std::cerr << "Failed to load replay! " << e.what() << std::endl;
+        }
     }
 
-    scoreText.setFont(font);
-    scoreText.setCharacterSize(24);
-    scoreText.setFillColor(sf::Color::White);
-    scoreText.setPosition(10, 10);
+    if (playback) {
+        // A replay only matches the maps it was recorded on
+        world = std::make_unique<Logic::World>(factory, playback->getSeed(), playback->getMapName());
+        if (world->getMapHash() != playback->getMapHash()) {
+            std::cerr << "Replay was recorded on a different version of " << playback->getMapName()
+                      << ", playback will diverge" << std::endl;
+        }
+        if (playback->getTickLength() != LOGIC_TICK) {
+            std::cerr << "Replay was recorded with a different logic tick, playback will diverge" << std::endl;
+        }
+    } else {
+        const std::string mapPath = options.mapPath.empty() ? Logic::World::DEFAULT_MAP : options.mapPath;
+        world = std::make_unique<Logic::World>(factory, Logic::Random::entropySeed(), mapPath);
+    }
 
-    livesText.setFont(font);
-    livesText.setCharacterSize(24);
-    livesText.setFillColor(sf::Color::Yellow);
-    livesText.setPosition(10, 40);
+    if (!options.recordPath.empty()) {
+        recordPath = options.recordPath;
+        recording.emplace(world->getSeed(), LOGIC_TICK, world->getMapName(), world->getMapHash());
+    }
+
+    simulation = std::make_unique<Logic::SimulationThread>(*world, LOGIC_TICK, [this] { return nextInput(); });
+    refreshFrame();
+
+    // Don't count the time spent in the menu as the first frame
+    Logic::Stopwatch::getInstance().reset();
+
+    hud = std::make_shared<Render::HudLayer>(*loadFont(), 24, window);
+    scoreCounter = hud->addCounter("Score: ", {10, 10}, sf::Color::White, 9);
+    livesCounter = hud->addCounter("Lives: ", {10, 40}, sf::Color::Yellow, 2);
+    levelCounter = hud->addCounter("Level: ", {10, 70}, sf::Color::Cyan, 4);
+    factory->getRenderer()->add(hud, Render::RenderLayer::Hud);
+
+    font = loadFont();
+    profilerText.setFont(*font);
+    profilerText.setCharacterSize(14);
+    profilerText.setFillColor(sf::Color::Green);
+    profilerText.setPosition(10, 110);
+    tracePath = options.tracePath.empty() ? Logic::Profiler::DEFAULT_TRACE_FILE : options.tracePath;
+}
+
+LevelState::~LevelState() {
+    // The simulation thread writes the recording and the World until it is joined
+    simulation->stop();
+
+    // Leaving the level ends a capture and stops measuring
+    if (Logic::Profiler::isTracing()) toggleTrace();
+    Logic::Profiler::setEnabled(false);
+
+    if (!recording) return;
+    try {
+        recording->save(recordPath);
+        std::cout << "Replay saved to " << recordPath << " (" << recording->getTickCount() << " ticks)" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to save replay! " << e.what() << std::endl;
+    }
+}
+
+char LevelState::nextInput() {
+    // Runs on the simulation thread, once per tick
+    const char input = playback ? playback->inputAt(tick) : keyboardInput.load(std::memory_order_relaxed);
+    if (recording) recording->record(input);
+    tick++;
+    return input;
+}
+
+void LevelState::refreshFrame() {
+    // Only while the simulation is stopped: read the World directly, e.g. right after nextLevel()
+    Logic::WorldSnapshot& frame = factory->getFrame();
+    world->captureLevel(frame);
+    frame.time = std::chrono::steady_clock::now();
+}
 
-    levelText.setFont(font);
-    levelText.setCharacterSize(24);
-    levelText.setFillColor(sf::Color::Cyan);
-    levelText.setPosition(10, 70);
+char LevelState::readKeyboard() {
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Up))    return 'U';
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Down))  return 'D';
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Left))  return 'L';
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Right)) return 'R';
+    return 0;
 }
 
 void LevelState::handleResize(unsigned int width, unsigned int height) {
@@ -179,41 +272,123 @@ void LevelState::handleResize(unsigned int width, unsigned int height) {
 
 void LevelState::processEvents(const sf::Event& event, sf::RenderWindow& window, StateManager& stateManager) {
     if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape) {
+        // No ticks while paused; update() restarts the simulation when this state is back on top
+        simulation->stop();
         stateManager.push(std::make_unique<PauseState>(window));
         return;
     }
+
+    if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3) {
+        profilerVisible = !profilerVisible;
+        if (profilerVisible) Logic::Profiler::getInstance().reset();
+        Logic::Profiler::setEnabled(profilerVisible || Logic::Profiler::isTracing());
+        profilerRefresh = 0.0f;
+    }
+
+    if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F4) {
+        toggleTrace();
+    }
 }
 
-void LevelState::update(sf::RenderWindow& window, StateManager& stateManager) {
-    if (world->isGameOver()) {
-        int finalScore = world->getScore();
-        std::cout << "Game Over! Final Score: " << finalScore << std::endl;
-        stateManager.pop();
-        stateManager.push(std::make_unique<GameOverState>(window, finalScore));
+void LevelState::toggleTrace() {
+    Logic::Profiler& profiler = Logic::Profiler::getInstance();
+    if (!Logic::Profiler::isTracing()) {
+        Logic::Profiler::setEnabled(true);
+        profiler.startTrace();
+        std::cout << "Recording trace, press F4 again to save it" << std::endl;
         return;
     }
 
-    if (world->isLevelComplete()) {
-        world->nextLevel();
+    try {
+        const std::size_t events = profiler.stopTrace(tracePath);
+        std::cout << "Trace saved to " << tracePath << " (" << events << " events)" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to save trace! " << e.what() << std::endl;
     }
+    Logic::Profiler::setEnabled(profilerVisible);
+}
 
-    char input = 0;
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Up))    input = 'U';
-    else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Down))  input = 'D';
-    else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Left))  input = 'L';
-    else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Right)) input = 'R';
+void LevelState::refreshProfilerText() {
+    const Logic::Profiler& profiler = Logic::Profiler::getInstance();
+
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(1) << "phase          p50 us     p99 us\n";
+    for (std::size_t i = 0; i < static_cast<std::size_t>(Logic::ProfilePhase::Count); ++i) {
+        const auto phase = static_cast<Logic::ProfilePhase>(i);
+        const Logic::PhaseStats stats = profiler.stats(phase);
+        text << std::left << std::setw(10) << Logic::Profiler::phaseName(phase) << std::right;
+        if (stats.samples == 0) text << std::setw(11) << "-" << std::setw(11) << "-";
+        else text << std::setw(11) << stats.p50 << std::setw(11) << stats.p99;
+        text << "\n";
+    }
+    if (Logic::Profiler::isTracing()) text << "recording trace (F4 to save)\n";
+    profilerText.setString(text.str());
+}
 
-    world->update(input);
+void LevelState::update(sf::RenderWindow& window, StateManager& stateManager) {
+    Logic::Stopwatch& stopwatch = Logic::Stopwatch::getInstance();
+    stopwatch.update();
+    camera->setFrameTime(stopwatch.getDeltaTime());
+    keyboardInput.store(readKeyboard(), std::memory_order_relaxed);
+
+    // Stopped at a level end, at game over, before the first frame or after a pause.
+    // Once joined, the World is ours until the simulation is started again.
+    if (!simulation->isRunning()) {
+        simulation->stop();
+
+        if (world->isGameOver()) {
+            int finalScore = world->getScore();
+            std::cout << "Game Over! Final Score: " << finalScore << std::endl;
+            stateManager.pop();
+            stateManager.push(std::make_unique<GameOverState>(window, finalScore));
+            return;
+        }
+
+        if (world->isLevelComplete()) {
+            world->nextLevel();
+        }
 
-    scoreText.setString("Score: " + std::to_string(world->getScore()));
-    livesText.setString("Lives: " + std::to_string(world->getLives()));
-    levelText.setString("Level: " + std::to_string(world->getCurrentLevel()));
+        refreshFrame();
+        simulation->start();
+    }
+
+    // Draw the newest tick; skipped snapshots cost nothing
+    Logic::WorldSnapshot& frame = factory->getFrame();
+    simulation->acquire(frame);
+
+    // Draw the state between the last two ticks
+    const float sinceTick = std::chrono::duration<float>(std::chrono::steady_clock::now() - frame.time).count();
+    camera->setInterpolation(std::min(sinceTick / LOGIC_TICK, 1.0f));
+
+    // Advance view animations once per frame; drawing happens in draw()
+    world->notifyViews();
+
+    // Only digits that changed are rewritten
+    {
+        PROFILE_SCOPE(Hud);
+        hud->set(scoreCounter, frame.score);
+        hud->set(livesCounter, frame.lives);
+        hud->set(levelCounter, frame.level);
+    }
+
+    // A few times a second is enough to read the numbers
+    if (profilerVisible) {
+        profilerRefresh -= stopwatch.getDeltaTime();
+        if (profilerRefresh <= 0.0f) {
+            refreshProfilerText();
+            profilerRefresh = PROFILER_REFRESH;
+        }
+    }
 }
 
 void LevelState::draw(sf::RenderWindow& window) {
-    window.draw(scoreText);
-    window.draw(livesText);
-    window.draw(levelText);
+    // One pass over all views and the HUD, sorted by layer and texture
+    {
+        PROFILE_SCOPE(Render);
+        factory->getRenderer()->render();
+    }
+
+    if (profilerVisible) window.draw(profilerText);
 }
 
 // ============================================
@@ -225,14 +400,12 @@ PauseState::PauseState(sf::RenderWindow& window) {
 
     sf::Vector2u windowSize = window.getSize();
 
-    if (!font.loadFromFile("../assets/DejaVuSans.ttf")) {
-        std::cerr << "Failed to load font!" << std::endl;
-    }
+    font = loadFont();
 
     overlay.setSize(sf::Vector2f(windowSize.x, windowSize.y));
     overlay.setFillColor(sf::Color(0, 0, 0, 180));
 
-    titleText.setFont(font);
+    titleText.setFont(*font);
     titleText.setString("PAUSED");
     titleText.setCharacterSize(60);
     titleText.setFillColor(sf::Color::Yellow);
@@ -242,7 +415,7 @@ PauseState::PauseState(sf::RenderWindow& window) {
     continueButton.setOutlineThickness(3);
     continueButton.setOutlineColor(sf::Color::White);
 
-    continueButtonText.setFont(font);
+    continueButtonText.setFont(*font);
     continueButtonText.setString("CONTINUE");
     continueButtonText.setCharacterSize(30);
     continueButtonText.setFillColor(sf::Color::White);
@@ -252,7 +425,7 @@ PauseState::PauseState(sf::RenderWindow& window) {
     menuButton.setOutlineThickness(3);
     menuButton.setOutlineColor(sf::Color::White);
 
-    menuButtonText.setFont(font);
+    menuButtonText.setFont(*font);
     menuButtonText.setString("MAIN MENU");
     menuButtonText.setCharacterSize(30);
     menuButtonText.setFillColor(sf::Color::White);
@@ -345,21 +518,19 @@ GameOverState::GameOverState(sf::RenderWindow& window, int score) : finalScore(s
 
     sf::Vector2u windowSize = window.getSize();
 
-    if (!font.loadFromFile("../assets/DejaVuSans.ttf")) {
-        std::cerr << "Failed to load font!" << std::endl;
-    }
+    font = loadFont();
 
-    titleText.setFont(font);
+    titleText.setFont(*font);
     titleText.setString("GAME OVER");
     titleText.setCharacterSize(60);
     titleText.setFillColor(sf::Color::Red);
 
-    scoreText.setFont(font);
+    scoreText.setFont(*font);
     scoreText.setString("Final Score: " + std::to_string(finalScore));
     scoreText.setCharacterSize(40);
     scoreText.setFillColor(sf::Color::White);
 
-    promptText.setFont(font);
+    promptText.setFont(*font);
     promptText.setString("Enter your name:");
     promptText.setCharacterSize(30);
     promptText.setFillColor(sf::Color::White);
@@ -369,7 +540,7 @@ GameOverState::GameOverState(sf::RenderWindow& window, int score) : finalScore(s
     inputBox.setOutlineThickness(3);
     inputBox.setOutlineColor(sf::Color::White);
 
-    nameInputText.setFont(font);
+    nameInputText.setFont(*font);
     nameInputText.setCharacterSize(30);
     nameInputText.setFillColor(sf::Color::Yellow);
     nameInputText.setString("_");
@@ -379,7 +550,7 @@ GameOverState::GameOverState(sf::RenderWindow& window, int score) : finalScore(s
     submitButton.setOutlineThickness(3);
     submitButton.setOutlineColor(sf::Color::White);
 
-    submitButtonText.setFont(font);
+    submitButtonText.setFont(*font);
     submitButtonText.setString("SUBMIT");
     submitButtonText.setCharacterSize(30);
     submitButtonText.setFillColor(sf::Color::White);
@@ -2,9 +2,15 @@
 #ifndef PACMAN_RETRY_STATE_H
 #define PACMAN_RETRY_STATE_H
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <SFML/Graphics.hpp>
+#include "Logic/Replay.h"
 #include "Logic/Stopwatch.h"
+#include "Representation/Game.h"
+#include "Representation/HudLayer.h"
 
 namespace Render {
     class ConcreteFactory;
@@ -14,6 +20,8 @@ namespace Render {
 namespace Logic {
     class World;
     class ScoreManager;
+    class LeaderboardWatcher;
+    class SimulationThread;
 }
 
 class StateManager;
@@ -32,19 +40,23 @@ public:
 // ============ MENU STATE ============
 class MenuState final : public State {
 private:
-    sf::Font font;
+    std::shared_ptr<const sf::Font> font;  ///< Shared through ResourceCache
     sf::Text titleText;
     sf::Text leaderboardTitleText;
     std::vector<sf::Text> scoreTexts;
     sf::RectangleShape playButton;
     sf::Text playButtonText;
     sf::Vector2u windowSize;
+    GameOptions options;  ///< Passed on to every LevelState
+    std::unique_ptr<Logic::LeaderboardWatcher> leaderboard;  ///< Reloads the scores file when it changes
+    std::uint64_t leaderboardVersion = 0;                    ///< Version the score texts were built from
 
     void loadScores();
     void repositionUI();
 
 public:
-    explicit MenuState(sf::RenderWindow& window);
+    MenuState(sf::RenderWindow& window, GameOptions options);
+    ~MenuState() override;
 
     void processEvents(const sf::Event& event, sf::RenderWindow& window, StateManager& stateManager) override;
     void update(sf::RenderWindow& window, StateManager& stateManager) override;
@@ -59,14 +71,43 @@ private:
     std::shared_ptr<Render::ConcreteFactory> factory;
     std::shared_ptr<Render::Camera> camera;
 
-    // UI elements
-    sf::Font font;
-    sf::Text scoreText;
-    sf::Text livesText;
-    sf::Text levelText;
+    // Fixed-timestep simulation on its own thread
+    static constexpr float LOGIC_TICK = 1.0f / 120.0f;  ///< Seconds simulated per World::update
+    std::atomic<char> keyboardInput{0};                 ///< Sampled every frame, read by every tick
+
+    // Replays (only touched by the simulation thread while it runs)
+    std::optional<Logic::Replay> playback;   ///< Inputs are read from here instead of the keyboard
+    std::optional<Logic::Replay> recording;  ///< Inputs are appended here and saved on exit
+    std::string recordPath;
+    std::size_t tick = 0;                    ///< Logic ticks simulated so far
+
+    // Declared after everything its ticks use, so it is stopped before they are destroyed
+    std::unique_ptr<Logic::SimulationThread> simulation;
+
+    static char readKeyboard();
+    char nextInput();
+    void refreshFrame();
+
+    // UI elements, drawn by the renderer on top of the level
+    std::shared_ptr<Render::HudLayer> hud;
+    std::size_t scoreCounter = 0;
+    std::size_t livesCounter = 0;
+    std::size_t levelCounter = 0;
+
+    // Profiler overlay (F3) and trace capture (F4)
+    static constexpr float PROFILER_REFRESH = 0.25f;  ///< Seconds between two overlay updates
+    std::shared_ptr<const sf::Font> font;  ///< Shared through ResourceCache
+    sf::Text profilerText;
+    bool profilerVisible = false;
+    float profilerRefresh = 0.0f;  ///< Seconds until the overlay text is rebuilt
+    std::string tracePath;
+
+    void toggleTrace();
+    void refreshProfilerText();
 
 public:
-    explicit LevelState(sf::RenderWindow &window);
+    LevelState(sf::RenderWindow &window, const GameOptions& options);
+    ~LevelState() override;
 
     void processEvents(const sf::Event& event, sf::RenderWindow& window, StateManager& stateManager) override;
     void update(sf::RenderWindow& window, StateManager& stateManager) override;
@@ -77,7 +118,7 @@ public:
 // ============ PAUSE STATE ============
 class PauseState final : public State {
 private:
-    sf::Font font;
+    std::shared_ptr<const sf::Font> font;  ///< Shared through ResourceCache
     sf::Text titleText;
     sf::RectangleShape continueButton;
     sf::Text continueButtonText;
@@ -99,7 +140,7 @@ public:
 // ============ GAME OVER STATE ============
 class GameOverState final : public State {
 private:
-    sf::Font font;
+    std::shared_ptr<const sf::Font> font;  ///< Shared through ResourceCache
     sf::Text titleText;
     sf::Text scoreText;
     sf::Text promptText;
@@ -4,16 +4,23 @@
 
 #include "EntityView.h"
 #include "Logic/Entities/Entity.h"
+#include "Representation/ResourceCache.h"
 #include <stdexcept>
 
 namespace Render {
     void EntityView::draw() {
-        if (const auto entity = model.lock()) {
-            const sf::Vector2f screenPos = camera->worldToScreen(entity->getX(), entity->getY());
+        if (store.isValid(model)) {
+            const std::uint32_t row = model.index;
+
+            // Blend between the last two logic ticks so motion stays smooth at any frame rate
+            const float alpha = camera->getInterpolation();
+            const float x = store.getPreviousX(row) + (store.getX(row) - store.getPreviousX(row)) * alpha;
+            const float y = store.getPreviousY(row) + (store.getY(row) - store.getPreviousY(row)) * alpha;
+            const sf::Vector2f screenPos = camera->worldToScreen(x, y);
 
             // Scale the sprite based on entity's world size
-            const float screenWidth = camera->worldToScreenSize(entity->getWidth());
-            const float screenHeight = camera->worldToScreenSize(entity->getHeight());
+            const float screenWidth = camera->worldToScreenSize(store.getWidth(row));
+            const float screenHeight = camera->worldToScreenSize(store.getHeight(row));
 
             const sf::IntRect textureRect = sprite.getTextureRect();
             const float scaleX = screenWidth / textureRect.width;
@@ -40,17 +47,14 @@ namespace Render {
         sprite.setScale(scaleX, scaleY);
     }
 
-    void EntityView::onNotify() {
-        // Handle notifications from the model if needed
-        draw();
+    void EntityView::onNotify(EventType) {
+        // Static sprite: nothing to update, the render pass draws it
     }
 
     bool EntityView::loadTexture(const std::string &filename) {
         try {
-            if (!texture.loadFromFile(filename)) {
-                throw std::runtime_error("Failed to load texture file: " + filename);
-            }
-            sprite.setTexture(texture);
+            texture = ResourceCache::getInstance().getTexture(filename);
+            sprite.setTexture(*texture);
             return true;
         } catch (const std::exception& e) {
             std::cerr << "Exception in loadTexture: " << e.what() << std::endl;
@@ -8,6 +8,7 @@
 #include <SFML/Graphics.hpp>
 #include "Logic/Observer.h"
 #include "Representation/Camera.h"
+#include "Representation/Renderer.h"
 #include "Logic/Entities/Entity.h"
 #include <iostream>
 
@@ -17,21 +18,28 @@ namespace Logic {
 
 namespace Render {
 
-    class EntityView : public Observer {
+    // Observes its entity for animation updates; drawn by the Renderer, never from onNotify()
+    class EntityView : public Observer, public Drawable {
     protected:
         sf::Sprite sprite;
-        sf::Texture texture;
-        std::weak_ptr<Logic::Entity> model;
+        std::shared_ptr<const sf::Texture> texture;  ///< Shared through ResourceCache
+        const Logic::EntityStore& store;  ///< Latest snapshot of the model's data, never the live World store
+        Logic::EntityHandle model;        ///< Row of the observed entity in store
         std::shared_ptr<Camera> camera;
         sf::RenderWindow& window;
 
     public:
-        EntityView(const std::shared_ptr<Logic::Entity>& entity, const std::shared_ptr<Camera>& cam, sf::RenderWindow& win)
-            : model(entity), camera(cam), window(win) {}
+        EntityView(const std::shared_ptr<Logic::Entity>& entity, const Logic::EntityStore& frame,
+                   const std::shared_ptr<Camera>& cam, sf::RenderWindow& win)
+            : store(frame), model(entity->getHandle()), camera(cam), window(win) {}
         ~EntityView() override = default;
 
-        virtual void draw();
-        void onNotify() override;
+        // Events the factory subscribes this view to
+        static constexpr EventMask EVENTS = eventBit(EventType::AnimationUpdate);
+
+        void draw() override;
+        void onNotify(EventType event) override;
+        [[nodiscard]] const sf::Texture* getTexture() const override { return texture.get(); }
 
     protected:
         bool loadTexture(const std::string& filename);
@@ -1,33 +1,30 @@
 //
-// GhostView.cpp - Using Stopwatch singleton for timing
+// GhostView.cpp - Animation timed by the camera's frame time
 //
 
 #include "GhostView.h"
-#include "Logic/Stopwatch.h"
-#include <iostream>
+#include "Representation/ResourceCache.h"
+#include "Logic/Log.h"
 
 namespace Render {
     GhostView::GhostView(const std::shared_ptr<Logic::Entity>& entity,
+                         const Logic::EntityStore& frame,
                          const std::shared_ptr<Camera>& cam,
                          sf::RenderWindow& win,
                          int id)
-        : EntityView(entity, cam, win), spriteId(id), currentFrame(0),
+        : EntityView(entity, frame, cam, win), spriteId(id), currentFrame(0),
           animationSpeed(0.2f), animationAccumulator(0.0f),
           blinkAccumulator(0.0f), isWhiteFeared(false) {
 
-        if (!texture.loadFromFile("../assets/spritesheet.png")) {
-            std::cerr << "Failed to load ghost texture!" << std::endl;
-        }
-        sprite.setTexture(texture);
+        loadTexture(SPRITESHEET_PATH);
 
         // Set initial frame
         updateSpriteForState();
     }
 
     void GhostView::updateAnimation() {
-        // Accumulate time using Stopwatch singleton
-        float deltaTime = Logic::Stopwatch::getInstance().getDeltaTime();
-        animationAccumulator += deltaTime;
+        // Accumulate the time of this rendered frame
+        animationAccumulator += camera->getFrameTime();
 
         // Update animation frame when enough time has passed
         if (animationAccumulator >= animationSpeed) {
@@ -39,13 +36,11 @@ namespace Render {
     }
 
     void GhostView::updateSpriteForState() {
-        // Get entity using polymorphic interface - NO CASTING!
-        auto entity = model.lock();
-        if (!entity) return;
+        // Read the model's row in the store - NO CASTING!
+        if (!store.isValid(model)) return;
 
-        // Use polymorphic methods from Entity base class
-        int stateInt = entity->getStateInt();
-        char direction = entity->getDirection();
+        int stateInt = store.getState(model.index);
+        char direction = store.getDirection(model.index);
 
         // Convert state int back to enum for readability
         // 0=WAITING, 1=CHASING, 2=FEARED, 3=DEAD
@@ -113,18 +108,15 @@ namespace Render {
     }
 
     void GhostView::checkFearedBlinking() {
-        // Get entity using polymorphic interface - NO CASTING!
-        auto entity = model.lock();
-        if (!entity) return;
+        // Read the model's row in the store - NO CASTING!
+        if (!store.isValid(model)) return;
 
-        int stateInt = entity->getStateInt();
-        float stateTimer = entity->getStateTimer();
+        int stateInt = store.getState(model.index);
+        float stateTimer = store.getTimer(model.index);
 
         // Only blink when feared (state 2) and timer is less than 2 seconds
         if (stateInt == 2 && stateTimer < 2.0f) {
-            // Accumulate time using Stopwatch singleton
-            float deltaTime = Logic::Stopwatch::getInstance().getDeltaTime();
-            blinkAccumulator += deltaTime;
+            blinkAccumulator += camera->getFrameTime();
 
             // Blink between blue and white every 0.2 seconds
             if (blinkAccumulator >= 0.2f) {
@@ -139,16 +131,15 @@ namespace Render {
     }
 
     void GhostView::draw() {
-        // Get entity to check if despawned
-        auto entity = model.lock();
-        if (!entity) return;
+        // Check the model's row to see if despawned
+        if (!store.isValid(model)) return;
 
-        int stateInt = entity->getStateInt();
+        int stateInt = store.getState(model.index);
 
         // Debug output
         static int frameCount = 0;
         if (frameCount++ % 60 == 0) { // Print every 60 frames
-            std::cout << "Ghost " << spriteId << " drawing - state: " << stateInt << std::endl;
+            LOG_DEBUG(Render) << "Ghost " << spriteId << " drawing - state: " << stateInt;
         }
 
         // Don't draw if ghost is despawned (state 4)
@@ -157,18 +148,25 @@ namespace Render {
             return; // Ghost is invisible
         }
 
-        // Check if we should blink in feared state
-        checkFearedBlinking();
-
-        // Update animation before drawing
-        updateAnimation();
-
         // Call the parent draw method to handle positioning and scaling
         EntityView::draw();
     }
 
-    void GhostView::onNotify() {
-        // When notified by the model, update animation and draw
-        draw();
+    void GhostView::onNotify(const EventType event) {
+        if (event != EventType::AnimationUpdate || !store.isValid(model)) return;
+
+        // New state since the last frame (feared, dead, ...): restart its animation and stop blinking
+        const int state = store.getState(model.index);
+        if (state != lastState) {
+            currentFrame = 0;
+            animationAccumulator = 0.0f;
+            blinkAccumulator = 0.0f;
+            isWhiteFeared = false;
+            lastState = state;
+        }
+
+        // Once per frame: blink and pick the sprite frame the render pass will draw
+        checkFearedBlinking();
+        updateAnimation();
     }
 }
\ No newline at end of file
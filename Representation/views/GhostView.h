@@ -1,5 +1,5 @@
 //
-// GhostView.h - Using Stopwatch singleton
+// GhostView.h - Ghost sprite with walking, feared and eyes-only animation
 //
 
 #ifndef PACMAN_RETRY_GHOSTVIEW_H
@@ -16,6 +16,7 @@ namespace Render {
         float animationAccumulator; // Accumulated time since last frame change
         float blinkAccumulator; // Accumulated time for blinking
         bool isWhiteFeared; // For blinking between blue and white when feared timer is low
+        int lastState = -1; // State in the previous frame, to restart the animation on a change
 
         void updateAnimation();
         void updateSpriteForState();
@@ -24,12 +25,13 @@ namespace Render {
 
     public:
         GhostView(const std::shared_ptr<Logic::Entity>& entity,
+                  const Logic::EntityStore& frame,
                   const std::shared_ptr<Camera>& cam,
                   sf::RenderWindow& win,
                   int id);
 
         void draw() override;
-        void onNotify() override;
+        void onNotify(EventType event) override;
     };
 }
 
@@ -3,22 +3,19 @@
 //
 
 #include "PacmanView.h"
-#include "Logic/Stopwatch.h"
+#include "Representation/ResourceCache.h"
 #include <stdexcept>
 
 namespace Render {
     PacmanView::PacmanView(const std::shared_ptr<Logic::Entity>& entity,
+                           const Logic::EntityStore& frame,
                            const std::shared_ptr<Camera>& cam,
                            sf::RenderWindow& win)
-        : EntityView(entity, cam, win), currentFrame(0), animationSpeed(0.15f),
+        : EntityView(entity, frame, cam, win), currentFrame(0), animationSpeed(0.15f),
           animationAccumulator(0.0f) {
 
         try {
-            if (!texture.loadFromFile("../assets/spritesheet.png")) {
-                throw std::runtime_error("Failed to load spritesheet.png for Pacman");
-            }
-
-            sprite.setTexture(texture);
+            loadTexture(SPRITESHEET_PATH);
 
             // Initialize with first frame facing right (full circle)
             setFrame(2*16, 0, 16, 16);
@@ -29,16 +26,22 @@ namespace Render {
     }
 
     void PacmanView::updateAnimation() {
-        // Get the entity - no casting needed!
-        auto entity = model.lock();
-        if (!entity) return;
+        // Read the model's row - no casting needed!
+        if (!store.isValid(model)) return;
 
         // Check if dying
-        bool dying = entity->isDying();
+        bool dying = store.hasFlag(model.index, Logic::EntityStore::DYING);
+
+        // Just died: start the death animation from its first frame
+        if (dying && !wasDying) {
+            currentFrame = 0;
+            animationAccumulator = 0.0f;
+        }
+        wasDying = dying;
 
         if (dying) {
             // Death animation - 12 frames
-            animationAccumulator += Logic::Stopwatch::getInstance().getDeltaTime();
+            animationAccumulator += camera->getFrameTime();
 
             // Each frame lasts ~0.083 seconds (1.0s total / 12 frames)
             const float deathFrameDuration = 1.0f / 12.0f;
@@ -60,8 +63,8 @@ namespace Render {
         }
 
         // Normal animation
-        bool moving = entity->isMoving();
-        char direction = entity->getDirection();
+        bool moving = store.hasFlag(model.index, Logic::EntityStore::MOVING);
+        char direction = store.getDirection(model.index);
 
         // Only animate if Pacman is moving
         if (!moving) {
@@ -72,8 +75,8 @@ namespace Render {
             return;
         }
 
-        // Accumulate time using Stopwatch singleton
-        animationAccumulator += Logic::Stopwatch::getInstance().getDeltaTime();
+        // Accumulate the time of this rendered frame
+        animationAccumulator += camera->getFrameTime();
 
         // Update animation frame when enough time has passed
         if (animationAccumulator >= animationSpeed) {
@@ -156,16 +159,8 @@ namespace Render {
         sprite.setTextureRect(sf::IntRect(frameX, frameY, frameWidth, frameHeight));
     }
 
-    void PacmanView::draw() {
-        // Update animation before drawing
-        updateAnimation();
-
-        // Call the parent draw method to handle positioning and scaling
-        EntityView::draw();
-    }
-
-    void PacmanView::onNotify() {
-        // When notified by the model, update animation and draw
-        draw();
+    void PacmanView::onNotify(const EventType event) {
+        // Once per frame: pick the sprite frame the render pass will draw
+        if (event == EventType::AnimationUpdate) updateAnimation();
     }
 }
\ No newline at end of file
@@ -13,6 +13,7 @@ namespace Render {
         int currentFrame;
         float animationSpeed; // Time between frames in seconds
         float animationAccumulator; // Accumulated time since last frame change
+        bool wasDying = false; // Dying flag in the previous frame, to restart the death animation
 
         void updateAnimation();
         void updateSpriteForDirection(char direction);
@@ -20,12 +21,12 @@ namespace Render {
 
     public:
         PacmanView(const std::shared_ptr<Logic::Entity>& entity,
+                   const Logic::EntityStore& frame,
                    const std::shared_ptr<Camera>& cam,
                    sf::RenderWindow& win);
 
         void setFrame(int frameX, int frameY, int frameWidth, int frameHeight);
-        void draw() override;
-        void onNotify() override;
+        void onNotify(EventType event) override;
     };
 }
 
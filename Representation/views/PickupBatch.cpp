@@ -0,0 +1,115 @@
+//
+// PickupBatch.cpp
+//
+
+#include "PickupBatch.h"
+#include "Logic/Entities/Entity.h"
+#include "Representation/ResourceCache.h"
+
+namespace Render {
+    PickupBatch::PickupBatch(const Logic::WorldSnapshot& frame, const std::shared_ptr<Camera>& cam, sf::RenderWindow& win)
+        : texture(ResourceCache::getInstance().getTexture(SPRITESHEET_PATH)), frame(frame), camera(cam), window(win),
+          builtRevision(cam->getRevision()) {}
+
+    void PickupBatch::add(const Logic::Entity& entity, const sf::IntRect& frame) {
+        const Slot slot{entity.getX(), entity.getY(), entity.getWidth(), entity.getHeight(), frame, entity.getHandle(), true, true};
+
+        std::size_t index;
+        if (!freeSlots.empty()) {
+            index = freeSlots.back();
+            freeSlots.pop_back();
+            slots[index] = slot;
+        } else {
+            index = slots.size();
+            slots.push_back(slot);
+            vertices.resize(slots.size() * 6);
+        }
+
+        const std::uint32_t row = slot.entity.index;
+        if (row >= slotByRow.size()) slotByRow.resize(row + 1, NO_SLOT);
+        slotByRow[row] = index;
+
+        writeSlot(index);
+    }
+
+    void PickupBatch::syncSlot(const std::size_t index) {
+        Slot& slot = slots[index];
+        const Logic::EntityStore& store = frame.entities;
+
+        // Entity destroyed (row freed or reused): release the slot
+        if (!store.isValid(slot.entity)) {
+            if (slotByRow[slot.entity.index] == index) slotByRow[slot.entity.index] = NO_SLOT;
+            slot.used = false;
+            slot.visible = false;
+            writeSlot(index);
+            freeSlots.push_back(index);
+            return;
+        }
+
+        // Collected, or put back for the next level
+        if (const bool visible = !store.hasFlag(slot.entity.index, Logic::EntityStore::HIDDEN); visible != slot.visible) {
+            slot.visible = visible;
+            writeSlot(index);
+        }
+    }
+
+    void PickupBatch::sync() {
+        // New or rewound level: rows may have been destroyed, reused or shown again
+        if (frame.pickupEpoch != syncedEpoch) {
+            for (std::size_t i = 0; i < slots.size(); ++i) {
+                if (slots[i].used) syncSlot(i);
+            }
+            syncedEpoch = frame.pickupEpoch;
+            syncedChanges = frame.pickupChanges.size();
+            return;
+        }
+
+        // Same level: only the pickups collected since the last frame
+        for (; syncedChanges < frame.pickupChanges.size(); ++syncedChanges) {
+            const std::uint32_t row = frame.pickupChanges[syncedChanges];
+            if (row < slotByRow.size() && slotByRow[row] != NO_SLOT) syncSlot(slotByRow[row]);
+        }
+    }
+
+    void PickupBatch::writeSlot(const std::size_t index) {
+        const Slot& slot = slots[index];
+        sf::Vertex* quad = &vertices[index * 6];
+
+        if (!slot.visible) {
+            // Degenerate triangles draw nothing
+            for (int i = 0; i < 6; ++i) quad[i] = sf::Vertex();
+            return;
+        }
+
+        const sf::Vector2f center = camera->worldToScreen(slot.x, slot.y);
+        const float halfWidth = camera->worldToScreenSize(slot.width) / 2.0f;
+        const float halfHeight = camera->worldToScreenSize(slot.height) / 2.0f;
+
+        const auto left = static_cast<float>(slot.frame.left);
+        const auto top = static_cast<float>(slot.frame.top);
+        const auto right = static_cast<float>(slot.frame.left + slot.frame.width);
+        const auto bottom = static_cast<float>(slot.frame.top + slot.frame.height);
+
+        const sf::Vertex topLeft({center.x - halfWidth, center.y - halfHeight}, {left, top});
+        const sf::Vertex topRight({center.x + halfWidth, center.y - halfHeight}, {right, top});
+        const sf::Vertex bottomRight({center.x + halfWidth, center.y + halfHeight}, {right, bottom});
+        const sf::Vertex bottomLeft({center.x - halfWidth, center.y + halfHeight}, {left, bottom});
+
+        quad[0] = topLeft;
+        quad[1] = topRight;
+        quad[2] = bottomRight;
+        quad[3] = topLeft;
+        quad[4] = bottomRight;
+        quad[5] = bottomLeft;
+    }
+
+    void PickupBatch::draw() {
+        sync();
+
+        if (builtRevision != camera->getRevision()) {
+            for (std::size_t i = 0; i < slots.size(); ++i) writeSlot(i);
+            builtRevision = camera->getRevision();
+        }
+        window.draw(vertices, sf::RenderStates(texture.get()));
+    }
+}
@@ -0,0 +1,79 @@
+//
+// PickupBatch.h - Single draw call for all coins and fruits
+//
+
+#ifndef PACMAN_RETRY_PICKUPBATCH_H
+#define PACMAN_RETRY_PICKUPBATCH_H
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include "Logic/EntityStore.h"
+#include "Logic/Snapshot.h"
+#include "Representation/Camera.h"
+#include "Representation/Renderer.h"
+
+namespace Logic {
+    class Entity;
+}
+
+namespace Render {
+    /**
+     * @class PickupBatch
+     * @brief Draws every coin and fruit as quads of one vertex array
+     *
+     * Each coin and fruit gets one slot (6 vertices, two triangles)
+     * against the shared sprite sheet. The slot follows its entity in the
+     * frame snapshot: hidden while the pickup is collected, shown again when
+     * the next level reuses it, and released once the entity is gone. This
+     * happens on the render thread, never from the simulation that collected
+     * it. A frame only visits the slots of the pickups in the snapshot's
+     * pickupChanges it hasn't seen yet; every slot is checked only when the
+     * pickup epoch changed (new or rewound level). A change only rewrites
+     * that slot; the whole array is rebuilt only when the camera changes.
+     * Released slots are reused by the next pickup that is added.
+     */
+    class PickupBatch final : public Drawable {
+    private:
+        struct Slot {
+            float x, y, width, height; // Normalized world coordinates (center + size)
+            sf::IntRect frame;         // Sprite sheet rectangle
+            Logic::EntityHandle entity; // Pickup shown by this slot
+            bool used;                  // false once released
+            bool visible;
+        };
+
+        static constexpr std::size_t NO_SLOT = SIZE_MAX;
+
+        std::vector<Slot> slots;
+        std::vector<std::size_t> freeSlots;
+        std::vector<std::size_t> slotByRow;  ///< Store row -> slot showing it, NO_SLOT if none
+        sf::VertexArray vertices{sf::Triangles};
+        std::shared_ptr<const sf::Texture> texture;
+        const Logic::WorldSnapshot& frame;  ///< Decides which pickups still exist and which changed
+        std::uint32_t syncedEpoch = 0;      ///< Pickup epoch of the last full pass (World starts at 1)
+        std::size_t syncedChanges = 0;      ///< Entries of frame.pickupChanges already applied
+        std::shared_ptr<Camera> camera;
+        sf::RenderWindow& window;
+        unsigned int builtRevision;
+
+        void writeSlot(std::size_t index);
+        void syncSlot(std::size_t index);
+        void sync();
+
+    public:
+        PickupBatch(const Logic::WorldSnapshot& frame, const std::shared_ptr<Camera>& cam, sf::RenderWindow& win);
+
+        /**
+         * @brief Adds a quad for a pickup entity
+         * @param entity Pickup whose position and size are used
+         * @param frame Sprite sheet rectangle to show
+         */
+        void add(const Logic::Entity& entity, const sf::IntRect& frame);
+
+        void draw() override;
+        [[nodiscard]] const sf::Texture* getTexture() const override { return texture.get(); }
+    };
+}
+
+#endif //PACMAN_RETRY_PICKUPBATCH_H
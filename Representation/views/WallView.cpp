@@ -3,24 +3,62 @@
 //
 
 #include "WallView.h"
+#include "Logic/TileGrid.h"
 
 namespace Render {
-    void WallView::draw() {
-        if (const auto entity = model.lock()) {
-            const sf::Vector2f screenPos = camera->worldToScreen(entity->getX(), entity->getY());
+    void WallView::setWalls(const Logic::TileGrid& grid) {
+        // Same normalized layout as World: the map spans [-1, 1] on both axes
+        const float width = 2.0f / static_cast<float>(grid.getWidth());
+        const float height = 2.0f / static_cast<float>(grid.getHeight());
+
+        walls.clear();
+        for (int row = 0; row < grid.getHeight(); ++row) {
+            for (int column = 0; column < grid.getWidth(); ++column) {
+                if (!grid.isWall(column, row)) continue;
+                walls.push_back({-1.0f + width * (static_cast<float>(column) + 0.5f),
+                                 -1.0f + height * (static_cast<float>(row) + 0.5f), width, height});
+            }
+        }
+        dirty = true;
+    }
+
+    void WallView::clear() {
+        walls.clear();
+        dirty = true;
+    }
 
-            const float screenWidth = camera->worldToScreenSize(entity->getWidth());
-            const float screenHeight = camera->worldToScreenSize(entity->getHeight());
+    void WallView::rebuild() {
+        vertices.resize(walls.size() * 6);
 
-            // Create a blue rectangle
-            sf::RectangleShape rectangle(sf::Vector2f(screenWidth, screenHeight));
-            rectangle.setFillColor(sf::Color::Blue);
+        for (std::size_t i = 0; i < walls.size(); ++i) {
+            const WallRect& wall = walls[i];
+            const sf::Vector2f center = camera->worldToScreen(wall.x, wall.y);
+            const float halfWidth = camera->worldToScreenSize(wall.width) / 2.0f;
+            const float halfHeight = camera->worldToScreenSize(wall.height) / 2.0f;
 
-            // Set origin to center so it aligns with entity position
-            rectangle.setOrigin(screenWidth / 2.0f, screenHeight / 2.0f);
-            rectangle.setPosition(screenPos);
+            const sf::Vector2f topLeft(center.x - halfWidth, center.y - halfHeight);
+            const sf::Vector2f topRight(center.x + halfWidth, center.y - halfHeight);
+            const sf::Vector2f bottomRight(center.x + halfWidth, center.y + halfHeight);
+            const sf::Vector2f bottomLeft(center.x - halfWidth, center.y + halfHeight);
 
-            window.draw(rectangle);
+            // Two triangles per wall
+            sf::Vertex* quad = &vertices[i * 6];
+            quad[0] = sf::Vertex(topLeft, sf::Color::Blue);
+            quad[1] = sf::Vertex(topRight, sf::Color::Blue);
+            quad[2] = sf::Vertex(bottomRight, sf::Color::Blue);
+            quad[3] = sf::Vertex(topLeft, sf::Color::Blue);
+            quad[4] = sf::Vertex(bottomRight, sf::Color::Blue);
+            quad[5] = sf::Vertex(bottomLeft, sf::Color::Blue);
+        }
+
+        builtRevision = camera->getRevision();
+        dirty = false;
+    }
+
+    void WallView::draw() {
+        if (dirty || builtRevision != camera->getRevision()) {
+            rebuild();
         }
+        window.draw(vertices);
     }
 }
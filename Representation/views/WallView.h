@@ -4,16 +4,51 @@
 
 #ifndef PACMAN_RETRY_WALLVIEW_H
 #define PACMAN_RETRY_WALLVIEW_H
-#include "EntityView.h"
+#include <memory>
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include "Representation/Camera.h"
+#include "Representation/Renderer.h"
+
+namespace Logic {
+    class TileGrid;
+}
 
 namespace Render {
-    class WallView final : public Render::EntityView {
+    /**
+     * @class WallView
+     * @brief Draws every wall of the level as one cached vertex array
+     *
+     * Walls never move and are not entities: the factory hands the level's
+     * wall grid to a single WallView once per built level. One quad per wall
+     * tile is baked into a vertex array that is only rebuilt when the walls
+     * change (a level with another map) or the camera changes (window
+     * resize), and drawn with one call per frame.
+     */
+    class WallView final : public Drawable {
+    private:
+        struct WallRect {
+            float x, y, width, height; // Normalized world coordinates (center + size)
+        };
+
+        std::vector<WallRect> walls;
+        sf::VertexArray vertices{sf::Triangles};
+        std::shared_ptr<Camera> camera;
+        sf::RenderWindow& window;
+        unsigned int builtRevision = 0; // Camera revision the vertices were built for
+        bool dirty = true;
+
+        void rebuild();
+
     public:
-        WallView(const std::shared_ptr<Logic::Entity>& entity, const std::shared_ptr<Camera>& cam, sf::RenderWindow& win) : EntityView(entity, cam, win) {};
-        ~WallView() override = default;
+        WallView(const std::shared_ptr<Camera>& cam, sf::RenderWindow& win) : camera(cam), window(win) {}
+
+        /// Replaces the walls with the wall tiles of a grid
+        void setWalls(const Logic::TileGrid& grid);
+        void clear();
         void draw() override;
     };
 }
 
 
-#endif //PACMAN_RETRY_WALLVIEW_H
\ No newline at end of file
+#endif //PACMAN_RETRY_WALLVIEW_H
@@ -1,8 +1,26 @@
+#include <iostream>
+#include <string>
 #include <Representation/Game.h>
+#include <Logic/Log.h>
 
 
-int main() {
-    Game game;
+int main(int argc, char* argv[]) {
+    GameOptions options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string flag = argv[i];
+        if (flag == "--record") options.recordPath = argv[i + 1];
+        else if (flag == "--replay") options.replayPath = argv[i + 1];
+        else if (flag == "--map") options.mapPath = argv[i + 1];
+        else if (flag == "--trace") options.tracePath = argv[i + 1];
+        else if (flag == "--log") {
+            Logic::LogLevel level;
+            if (Logic::Logger::parseLevel(argv[i + 1], level)) Logic::Logger::setLevel(level);
+            else std::cerr << "Unknown log level: " << argv[i + 1] << std::endl;
+        }
+        else std::cerr << "Unknown option: " << flag << std::endl;
+    }
+
+    Game game(options);
     game.run();
     return 0;
 }
\ No newline at end of file